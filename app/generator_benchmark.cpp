@@ -0,0 +1,91 @@
+#include "../include/CasinoBin.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs a function and returns its wall-clock time in milliseconds.
+ */
+template <typename F>
+double measure(F &&function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Benchmark comparing materialise-then-process with a coroutine pipeline.
+ *
+ * The program writes a binary file of casino results and computes the sum of its positive
+ * values twice:
+ * 1. Materialised: `load()` decodes the whole file into the reader, `getData()` is processed.
+ * 2. Pipeline: `generate()` → `filter()` → `fold()` processes every record as it is decoded.
+ *
+ * Usage: `generator_benchmark [records] [directory]`, by default 10M records in the
+ * temporary directory. The file is removed afterwards.
+ */
+int main(int argc, char *argv[])
+{
+    size_t records = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+    std::filesystem::path directory = argc > 2 ? std::filesystem::path(argv[2]) : std::filesystem::temp_directory_path();
+    std::string path = (directory / "generator_benchmark.bin").string();
+
+    // Write the input file in batches
+    double writeTime = measure([&]
+                               {
+                                   CasinoBinWriter writer(path);
+                                   std::vector<double> batch(4096);
+                                   for (size_t written = 0; written < records; written += batch.size())
+                                   {
+                                       batch.resize(std::min(batch.size(), records - written));
+                                       std::iota(batch.begin(), batch.end(), static_cast<double>(written) - static_cast<double>(records / 2));
+                                       writer.write(batch);
+                                   }
+                                   writer.close();
+                               });
+
+    auto positive = [](double value) { return value > 0.0; };
+
+    // 1. Materialise the file, then process the stored values
+    double materialisedSum = 0.0;
+    double materialisedTime = measure([&]
+                                      {
+                                          CasinoBinReader reader(path);
+                                          reader.load();
+                                          for (double value : reader.getData())
+                                          {
+                                              if (positive(value))
+                                              {
+                                                  materialisedSum += value;
+                                              }
+                                          }
+                                      });
+
+    // 2. Process every record in a decode → filter → accumulate pipeline
+    double pipelineSum = 0.0;
+    double pipelineTime = measure([&]
+                                  {
+                                      CasinoBinReader reader(path);
+                                      pipelineSum = reader.generate().filter(positive).fold(0.0, std::plus{});
+                                  });
+
+    std::filesystem::remove(path);
+
+    std::cout << "Records:      " << records << " (" << writeTime << " ms to write)\n"
+              << "Materialised: " << materialisedTime << " ms, " << records * sizeof(double) / (1024 * 1024) << " MiB held\n"
+              << "Pipeline:     " << pipelineTime << " ms, constant memory\n";
+
+    if (materialisedSum != pipelineSum)
+    {
+        std::cerr << "Results differ: " << materialisedSum << " != " << pipelineSum << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -15,7 +15,7 @@
  * 
  * This program performs the following steps:
  * 1. Runs one replication of a casino simulation.
- * 2. Stores the simulation results in binary files using `CasinoBinOutputManager`.
+ * 2. Stores the simulation results in binary files using `CasinoBinAsyncOutputManager`.
  * 3. Sets up a statistics manager (`StatisticsManager`) to analyze the stored results.
  * 4. Registers the output folder for analysis via `FolderStatistics`.
  * 5. Launches the GUI using `PresenterManager` to display the results.
@@ -24,9 +24,10 @@ int main()
 {
     std::string path = "/home/martin/results/casinobin/";
 
-    // Initialize the output manager with the target folder for binary output
-    CasinoBinOutputManager casinoOutputMnanager(path);
+    // Initialize the output manager with the target folder for binary output, written on I/O threads
+    CasinoBinAsyncOutputManager casinoOutputMnanager(path);
     casinoOutputMnanager.setName("Replication"); // Replications will be named "ReplicationX"
+    casinoOutputMnanager.setManifestEnabled(true); // List the replications in manifest.bin for the folder browser
 
     // Run 1 replication and save its results
     for (size_t i = 0; i < 1; i++)
@@ -5,7 +5,24 @@
 #include "../lib/include/Reader.h"
 #include "../lib/include/BinFileOut.h"
 #include "../lib/include/BinFileIn.h"
+#include "../lib/include/MappedBinFileIn.h"
+#include "../lib/include/BlockBinFileIn.h"
+#include "../lib/include/UringBinFileIn.h"
+#include "../lib/include/UringBinFileOut.h"
+#include "../lib/include/DirectBinFileOut.h"
+#include "../lib/include/ColumnConverter.h"
+#include "../lib/include/GorillaFileOut.h"
+#include "../lib/include/GorillaFileIn.h"
+#include "../lib/include/ColumnFileOut.h"
+#include "../lib/include/ColumnFileIn.h"
+#include "../lib/include/ContainerStreamOut.h"
+#include "../lib/include/ContainerStreamIn.h"
+#include "../lib/include/RawWriter.h"
+#include "../lib/include/RawReader.h"
+#include "../lib/include/PrefetchReader.h"
+#include "../lib/include/AsyncWriter.h"
 #include <cstring> // For memcpy
+#include <span>
 
 /**
  * @brief Converts a double value to and from a binary format with a count prefix.
@@ -15,6 +32,8 @@
 class CasinoBinConverter : public BinConverter<double>
 {
 public:
+    static constexpr size_t EncodedSize = sizeof(uint32_t) + sizeof(double); ///< Size of an encoded value in bytes.
+
     /**
      * @brief Converts a double value to binary format.
      * @param data The double to convert.
@@ -23,16 +42,44 @@ public:
     std::vector<uint8_t> convert(const double &data) override
     {
         // Create buffer: first 4 bytes for size (which is 1) followed by 8 bytes for the double
-        std::vector<uint8_t> buffer(sizeof(uint32_t) + sizeof(double));
-        
+        std::vector<uint8_t> buffer(EncodedSize);
+        encode(data, std::span<uint8_t>(buffer));
+        return buffer;
+    }
+
+    /**
+     * @brief Encodes a double value into a reusable buffer.
+     * @param data The double to convert.
+     * @param out The buffer receiving the binary data, resized to 12 bytes.
+     */
+    void encode(const double &data, std::vector<uint8_t> &out) override
+    {
+        out.resize(EncodedSize);
+        encode(data, std::span<uint8_t>(out));
+    }
+
+    /**
+     * @brief Encodes a double value into a caller-provided buffer.
+     * @param data The double to convert.
+     * @param out The buffer receiving the binary data, at least 12 bytes.
+     * @return The number of bytes written.
+     * @throws std::length_error if the buffer is too small.
+     */
+    size_t encode(const double &data, std::span<uint8_t> out) override
+    {
+        if (out.size() < EncodedSize)
+        {
+            throw std::length_error("Buffer too small for encoded data");
+        }
+
         // Write the count (always 1 for a single double)
         uint32_t count = 1;
-        std::memcpy(buffer.data(), &count, sizeof(count));
-        
+        std::memcpy(out.data(), &count, sizeof(count));
+
         // Write the double value
-        std::memcpy(buffer.data() + sizeof(uint32_t), &data, sizeof(data));
-        
-        return buffer;
+        std::memcpy(out.data() + sizeof(uint32_t), &data, sizeof(data));
+
+        return EncodedSize;
     }
 
     /**
@@ -42,6 +89,31 @@ public:
      * @throws std::runtime_error if the format is invalid or count is not 1.
      */
     double convert(const std::vector<uint8_t> &data) override
+    {
+        return convert(std::span<const uint8_t>(data));
+    }
+
+    /**
+     * @brief Converts a view of binary data back to a double.
+     * 
+     * Used by readers backed by `MappedBinFileIn` to decode records without copying them.
+     * 
+     * @param data A view of the bytes representing the binary format.
+     * @return The extracted double value.
+     * @throws std::runtime_error if the format is invalid or count is not 1.
+     */
+    double convert(std::span<const uint8_t> data)
+    {
+        return decode(data);
+    }
+
+    /**
+     * @brief Decodes a view of binary data to a double.
+     * @param data A view of the bytes representing the binary format.
+     * @return The extracted double value.
+     * @throws std::runtime_error if the format is invalid or count is not 1.
+     */
+    double decode(std::span<const uint8_t> data) override
     {
         // Check for minimum valid size (need at least 4 bytes for count and 8 bytes for double)
         if (data.size() < sizeof(uint32_t) + sizeof(double))
@@ -68,20 +140,219 @@ public:
 
 /**
  * @brief Writer class for serializing double values to a binary file using CasinoBinConverter.
+ * 
+ * Records are batched in the file handler's staging buffer and written out in large blocks.
  */
 class CasinoBinWriter : public Writer<double, CasinoBinConverter, BinFileOut>
 {
 public:
-    CasinoBinWriter() : Writer() {}
-    CasinoBinWriter(const std::string &pFile) : Writer(pFile) {}
+    CasinoBinWriter() : Writer() { getFile().setBufferSize(BinFileOut::DefaultBufferSize); }
+    CasinoBinWriter(const std::string &pFile) : Writer(pFile) { getFile().setBufferSize(BinFileOut::DefaultBufferSize); }
+};
+
+/**
+ * @brief Writer class writing the files of `CasinoBinWriter` on a dedicated I/O thread.
+ * 
+ * `write()` only queues the value; configure the queue with `setQueue()` before the first write.
+ */
+class CasinoBinAsyncWriter : public AsyncWriter<CasinoBinWriter>
+{
+public:
+    CasinoBinAsyncWriter() : AsyncWriter() {}
+    CasinoBinAsyncWriter(const std::string &pFile) : AsyncWriter(pFile) {}
+};
+
+/**
+ * @brief Writer class for serializing double values to a binary file with direct I/O.
+ */
+class CasinoBinDirectWriter : public Writer<double, CasinoBinConverter, DirectBinFileOut>
+{
+public:
+    CasinoBinDirectWriter() : Writer() {}
+    CasinoBinDirectWriter(const std::string &pFile) : Writer(pFile) {}
+};
+
+/**
+ * @brief Writer class for serializing double values to a binary file with asynchronous io_uring writes.
+ */
+class CasinoBinUringWriter : public Writer<double, CasinoBinConverter, UringBinFileOut>
+{
+public:
+    CasinoBinUringWriter() : Writer() {}
+    CasinoBinUringWriter(const std::string &pFile) : Writer(pFile) {}
+};
+
+/**
+ * @brief Writer class for storing double values as compressed blocks.
+ * 
+ * Files written by this class are read with `CasinoBinGorillaReader`, not `CasinoBinReader`.
+ */
+class CasinoBinGorillaWriter : public Writer<double, ColumnConverter, GorillaFileOut<BinFileOut>>
+{
+public:
+    CasinoBinGorillaWriter() : Writer() { getFile().getBlockFile().setBufferSize(BinFileOut::DefaultBufferSize); }
+    CasinoBinGorillaWriter(const std::string &pFile) : Writer(pFile) { getFile().getBlockFile().setBufferSize(BinFileOut::DefaultBufferSize); }
+};
+
+/**
+ * @brief Writer class for storing double values in a column file with per-block zone maps.
+ * 
+ * Files written by this class are read with `CasinoBinColumnReader`.
+ */
+class CasinoBinColumnWriter : public Writer<double, ColumnConverter, ColumnFileOut>
+{
+public:
+    CasinoBinColumnWriter() : Writer() {}
+    CasinoBinColumnWriter(const std::string &pFile) : Writer(pFile) {}
+};
+
+/**
+ * @brief Writer class for storing double values tightly packed in a raw column file.
+ * 
+ * Files written by this class are read with `CasinoBinRawReader`, not `CasinoBinReader`.
+ */
+class CasinoBinRawWriter : public RawWriter<double>
+{
+public:
+    CasinoBinRawWriter() : RawWriter() {}
+    CasinoBinRawWriter(const std::string &pFile) : RawWriter(pFile) {}
+};
+
+/**
+ * @brief Writer class for serializing double values to a stream of a replication container.
+ * 
+ * The container is attached through `getFile().attach()`, the path given to the writer is the stream name.
+ */
+class CasinoBinContainerWriter : public Writer<double, CasinoBinConverter, ContainerStreamOut>
+{
+public:
+    CasinoBinContainerWriter() : Writer() {}
+    CasinoBinContainerWriter(const std::string &pStream) : Writer(pStream) {}
 };
 
 /**
  * @brief Reader class for deserializing double values from a binary file using CasinoBinConverter.
  */
-class CasinoBinReader : public Reader<double, CasinoBinConverter, BinFileIn>
+class CasinoBinReader : public Reader<double, CasinoBinConverter, BinFileIn, ContiguousStorage<double>>
 {
 public:
     CasinoBinReader() : Reader() {}
     CasinoBinReader(const std::string &pFile) : Reader(pFile) {}
 };
+
+/**
+ * @brief Reader class reading the files of `CasinoBinReader` on a background thread.
+ * 
+ * Statistics written for `CasinoBinReader` use it unchanged, while the next records are
+ * read and decoded during their processing.
+ */
+class CasinoBinPrefetchReader : public PrefetchReader<CasinoBinReader>
+{
+public:
+    CasinoBinPrefetchReader() : PrefetchReader() {}
+    CasinoBinPrefetchReader(const std::string &pFile) : PrefetchReader(pFile) {}
+};
+
+/**
+ * @brief Reader class for deserializing double values from a memory-mapped binary file.
+ * 
+ * Reads the same files as `CasinoBinReader` but decodes records directly from the mapping.
+ */
+class CasinoBinMappedReader : public Reader<double, CasinoBinConverter, MappedBinFileIn, ContiguousStorage<double>>
+{
+public:
+    CasinoBinMappedReader() : Reader() {}
+    CasinoBinMappedReader(const std::string &pFile) : Reader(pFile) {}
+};
+
+/**
+ * @brief Reader class for deserializing double values from a binary file read in large blocks.
+ * 
+ * Reads the same files as `CasinoBinReader`, suitable where memory mapping is not an option.
+ */
+class CasinoBinBlockReader : public Reader<double, CasinoBinConverter, BlockBinFileIn, ContiguousStorage<double>>
+{
+public:
+    CasinoBinBlockReader() : Reader() {}
+    CasinoBinBlockReader(const std::string &pFile) : Reader(pFile) {}
+};
+
+/**
+ * @brief Reader class for deserializing double values from a binary file with io_uring read-ahead.
+ */
+class CasinoBinUringReader : public Reader<double, CasinoBinConverter, UringBinFileIn, ContiguousStorage<double>>
+{
+public:
+    CasinoBinUringReader() : Reader() {}
+    CasinoBinUringReader(const std::string &pFile) : Reader(pFile) {}
+};
+
+/**
+ * @brief Reader class for double values stored as compressed blocks by `CasinoBinGorillaWriter`.
+ * 
+ * The file is memory-mapped and every block is decoded once, the values are kept contiguous.
+ * `readBlock()` decodes whole blocks into a caller's buffer, bypassing the per-value reads.
+ */
+class CasinoBinGorillaReader : public Reader<double, ColumnConverter, GorillaFileIn<MappedBinFileIn>, ContiguousStorage<double>>
+{
+public:
+    CasinoBinGorillaReader() : Reader() {}
+    CasinoBinGorillaReader(const std::string &pFile) : Reader(pFile) {}
+
+    /**
+     * @brief Decodes the next compressed block and appends its values to a vector.
+     *
+     * If the file is not already open, it will be opened.
+     *
+     * @param out The vector the values are appended to.
+     * @return The number of appended values, 0 at the end of the file.
+     * @throws std::runtime_error If the file cannot be opened, or reading or decoding fails.
+     */
+    size_t readBlock(std::vector<double> &out)
+    {
+        if (!isFileOpen())
+        {
+            prefetch();
+            if (!isFileOpen())
+            {
+                throw std::runtime_error("Failed to open file for reading");
+            }
+        }
+        return getFile().readBlock(out);
+    }
+};
+
+/**
+ * @brief Reader class for double values stored in a column file by `CasinoBinColumnWriter`.
+ * 
+ * Value ranges and footer aggregates are available through `getFile()` once the file is open,
+ * e.g. `reader.open(path); reader.getFile().countGreaterThan(0.6);`.
+ */
+class CasinoBinColumnReader : public Reader<double, ColumnConverter, ColumnFileIn, ContiguousStorage<double>>
+{
+public:
+    CasinoBinColumnReader() : Reader() {}
+    CasinoBinColumnReader(const std::string &pFile) : Reader(pFile) {}
+};
+
+/**
+ * @brief Reader class for deserializing double values from a stream of a replication container.
+ * 
+ * The container is attached through `getFile().attach()`, the path given to the reader is the stream name.
+ */
+class CasinoBinContainerReader : public Reader<double, CasinoBinConverter, ContainerStreamIn, ContiguousStorage<double>>
+{
+public:
+    CasinoBinContainerReader() : Reader() {}
+    CasinoBinContainerReader(const std::string &pStream) : Reader(pStream) {}
+};
+
+/**
+ * @brief Reader class for double values stored in a raw column file by `CasinoBinRawWriter`.
+ */
+class CasinoBinRawReader : public RawReader<double>
+{
+public:
+    CasinoBinRawReader() : RawReader() {}
+    CasinoBinRawReader(const std::string &pFile) : RawReader(pFile) {}
+};
@@ -3,16 +3,23 @@
 #include "../lib/include/OutputManager.h"
 #include "../lib/include/InputManager.h"
 #include "../lib/include/Replication.h"
+#include "../lib/include/ContainerOutputManager.h"
+#include "../lib/include/ArchiveOutputManager.h"
+#include "../lib/include/ConcurrentOutputManager.h"
+#include "../lib/include/ContainerReplication.h"
 #include "CasinoBin.h"
 
 /**
  * @brief Manages binary output writers for different casino simulation results.
+ * 
+ * @tparam W The writer type used for every result file, it selects the file backend.
  */
-class CasinoBinOutputManager : public OutputManager
+template <WriterConcept W>
+class BasicCasinoBinOutputManager : public OutputManager
 {
 public:
-    CasinoBinOutputManager() : OutputManager() {}
-    CasinoBinOutputManager(const std::string &path) : OutputManager(path) {}
+    BasicCasinoBinOutputManager() : OutputManager() {}
+    BasicCasinoBinOutputManager(const std::string &path) : OutputManager(path) {}
 
     /**
      * @brief Initializes writers for each type of simulation result.
@@ -21,11 +28,11 @@ public:
     {
         std::string path = getCurrentReplicationPath();
 
-        auto writer1 = std::make_shared<CasinoBinWriter>(path + "ruleta_red.csv");
-        auto writer2 = std::make_shared<CasinoBinWriter>(path + "ruleta_alt.csv");
-        auto writer3 = std::make_shared<CasinoBinWriter>(path + "automat.csv");
-        auto writer4 = std::make_shared<CasinoBinWriter>(path + "blackjack_con.csv");
-        auto writer5 = std::make_shared<CasinoBinWriter>(path + "blackjack_agg.csv");
+        auto writer1 = std::make_shared<W>(path + "ruleta_red.csv");
+        auto writer2 = std::make_shared<W>(path + "ruleta_alt.csv");
+        auto writer3 = std::make_shared<W>(path + "automat.csv");
+        auto writer4 = std::make_shared<W>(path + "blackjack_con.csv");
+        auto writer5 = std::make_shared<W>(path + "blackjack_agg.csv");
 
         registerWriter(writer1);
         registerWriter(writer2);
@@ -35,11 +42,11 @@ public:
     }
 
     // Getters for individual simulation result writers
-    std::shared_ptr<CasinoBinWriter> getWriterRR() { return getWriter<CasinoBinWriter>(0); }
-    std::shared_ptr<CasinoBinWriter> getWriterRA() { return getWriter<CasinoBinWriter>(1); }
-    std::shared_ptr<CasinoBinWriter> getWriterA() { return getWriter<CasinoBinWriter>(2); }
-    std::shared_ptr<CasinoBinWriter> getWriterBC() { return getWriter<CasinoBinWriter>(3); }
-    std::shared_ptr<CasinoBinWriter> getWriterBA() { return getWriter<CasinoBinWriter>(4); }
+    std::shared_ptr<W> getWriterRR() { return getWriter<W>(0); }
+    std::shared_ptr<W> getWriterRA() { return getWriter<W>(1); }
+    std::shared_ptr<W> getWriterA() { return getWriter<W>(2); }
+    std::shared_ptr<W> getWriterBC() { return getWriter<W>(3); }
+    std::shared_ptr<W> getWriterBA() { return getWriter<W>(4); }
 
     /**
      * @brief Writes a vector of simulation results to the corresponding writers.
@@ -56,13 +63,55 @@ public:
 };
 
 /**
- * @brief Manages binary input readers for loading simulation results.
+ * @brief Output manager writing casino simulation results through buffered binary files.
+ */
+using CasinoBinOutputManager = BasicCasinoBinOutputManager<CasinoBinWriter>;
+
+/**
+ * @brief Output manager handing independent replications to parallel simulation threads.
+ * 
+ * Every thread writes through its own `CasinoBinOutputManager` obtained with `newReplication()`.
+ */
+using CasinoBinConcurrentOutputManager = ConcurrentOutputManager<CasinoBinOutputManager>;
+
+/**
+ * @brief Output manager writing casino simulation results through buffered binary files on I/O threads.
+ * 
+ * `writeResults()` does not wait for the disk, the files are complete once the writers are closed.
+ */
+using CasinoBinAsyncOutputManager = BasicCasinoBinOutputManager<CasinoBinAsyncWriter>;
+
+/**
+ * @brief Output manager writing casino simulation results with direct I/O, bypassing the page cache.
+ */
+using CasinoBinDirectOutputManager = BasicCasinoBinOutputManager<CasinoBinDirectWriter>;
+
+/**
+ * @brief Output manager writing casino simulation results as compressed blocks.
  */
-class CasinoBinReplication : public Replication
+using CasinoBinGorillaOutputManager = BasicCasinoBinOutputManager<CasinoBinGorillaWriter>;
+
+/**
+ * @brief Output manager writing casino simulation results to column files with per-block zone maps.
+ */
+using CasinoBinColumnOutputManager = BasicCasinoBinOutputManager<CasinoBinColumnWriter>;
+
+/**
+ * @brief Output manager writing casino simulation results to raw column files without per-record framing.
+ */
+using CasinoBinRawOutputManager = BasicCasinoBinOutputManager<CasinoBinRawWriter>;
+
+/**
+ * @brief Manages readers for the files of a casino simulation replication.
+ * 
+ * @tparam R The reader type used for every result file, it selects the file backend.
+ */
+template <ReaderConcept R>
+class BasicCasinoBinReplication : public Replication
 {
 public:
-    CasinoBinReplication() : Replication() {}
-    CasinoBinReplication(const std::string &name) : Replication(name) {}
+    BasicCasinoBinReplication() : Replication() {}
+    BasicCasinoBinReplication(const std::string &name) : Replication(name) {}
 
     /**
      * @brief Initializes readers for each type of simulation result.
@@ -71,11 +120,11 @@ public:
     {
         std::string path = getBasePath();
 
-        auto reader1 = std::make_shared<CasinoBinReader>(path + "ruleta_red.csv");
-        auto reader2 = std::make_shared<CasinoBinReader>(path + "ruleta_alt.csv");
-        auto reader3 = std::make_shared<CasinoBinReader>(path + "automat.csv");
-        auto reader4 = std::make_shared<CasinoBinReader>(path + "blackjack_con.csv");
-        auto reader5 = std::make_shared<CasinoBinReader>(path + "blackjack_agg.csv");
+        auto reader1 = std::make_shared<R>(path + "ruleta_red.csv");
+        auto reader2 = std::make_shared<R>(path + "ruleta_alt.csv");
+        auto reader3 = std::make_shared<R>(path + "automat.csv");
+        auto reader4 = std::make_shared<R>(path + "blackjack_con.csv");
+        auto reader5 = std::make_shared<R>(path + "blackjack_agg.csv");
 
         registerReader(reader1);
         registerReader(reader2);
@@ -85,12 +134,144 @@ public:
     }
 };
 
+/**
+ * @brief Input manager for handling multiple `BasicCasinoBinReplication` instances.
+ * 
+ * @tparam R The reader type used for every result file.
+ */
+template <ReaderConcept R>
+class BasicCasinoBinInputManager : public InputManager<BasicCasinoBinReplication<R>>
+{
+public:
+    BasicCasinoBinInputManager() = default;
+    BasicCasinoBinInputManager(const std::string &path) : InputManager<BasicCasinoBinReplication<R>>(path) {}
+};
+
+/**
+ * @brief Manages binary input readers for loading simulation results.
+ */
+using CasinoBinReplication = BasicCasinoBinReplication<CasinoBinReader>;
+
 /**
  * @brief Input manager for handling multiple CasinoBinReplication instances.
  */
-class CasinoBinInputManager : public InputManager<CasinoBinReplication>
+using CasinoBinInputManager = BasicCasinoBinInputManager<CasinoBinReader>;
+
+/**
+ * @brief Manages prefetching readers for the files of `CasinoBinReplication`.
+ * 
+ * The readers are registered as `CasinoBinPrefetchReader` and can be retrieved as `CasinoBinReader`.
+ */
+using CasinoBinPrefetchReplication = BasicCasinoBinReplication<CasinoBinPrefetchReader>;
+
+/**
+ * @brief Input manager for handling multiple CasinoBinPrefetchReplication instances.
+ */
+using CasinoBinPrefetchInputManager = BasicCasinoBinInputManager<CasinoBinPrefetchReader>;
+
+/**
+ * @brief Manages readers for simulation results stored as compressed blocks.
+ */
+using CasinoBinGorillaReplication = BasicCasinoBinReplication<CasinoBinGorillaReader>;
+
+/**
+ * @brief Input manager for handling multiple CasinoBinGorillaReplication instances.
+ */
+using CasinoBinGorillaInputManager = BasicCasinoBinInputManager<CasinoBinGorillaReader>;
+
+/**
+ * @brief Manages writers for casino simulation results stored in replication containers.
+ * 
+ * @tparam M The container output manager, it selects whether containers are separate files or archive segments.
+ */
+template <std::derived_from<ContainerOutputManager> M>
+class BasicCasinoBinContainerOutputManager : public M
 {
 public:
-    CasinoBinInputManager() = default;
-    CasinoBinInputManager(const std::string &path) : InputManager(path) {}
+    BasicCasinoBinContainerOutputManager() : M() {}
+    BasicCasinoBinContainerOutputManager(const std::string &path) : M(path) {}
+
+    /**
+     * @brief Registers a stream for each type of simulation result.
+     */
+    void init() override
+    {
+        this->template registerStream<CasinoBinContainerWriter>("ruleta_red");
+        this->template registerStream<CasinoBinContainerWriter>("ruleta_alt");
+        this->template registerStream<CasinoBinContainerWriter>("automat");
+        this->template registerStream<CasinoBinContainerWriter>("blackjack_con");
+        this->template registerStream<CasinoBinContainerWriter>("blackjack_agg");
+    }
+
+    // Getters for individual simulation result writers
+    std::shared_ptr<CasinoBinContainerWriter> getWriterRR() { return this->template getWriter<CasinoBinContainerWriter>(0); }
+    std::shared_ptr<CasinoBinContainerWriter> getWriterRA() { return this->template getWriter<CasinoBinContainerWriter>(1); }
+    std::shared_ptr<CasinoBinContainerWriter> getWriterA() { return this->template getWriter<CasinoBinContainerWriter>(2); }
+    std::shared_ptr<CasinoBinContainerWriter> getWriterBC() { return this->template getWriter<CasinoBinContainerWriter>(3); }
+    std::shared_ptr<CasinoBinContainerWriter> getWriterBA() { return this->template getWriter<CasinoBinContainerWriter>(4); }
+
+    /**
+     * @brief Writes a vector of simulation results to the corresponding streams.
+     * @param results A vector of 5 double values from the simulation.
+     */
+    void writeResults(std::vector<double> results)
+    {
+        getWriterRR()->write(results[0]);
+        getWriterRA()->write(results[1]);
+        getWriterA()->write(results[2]);
+        getWriterBC()->write(results[3]);
+        getWriterBA()->write(results[4]);
+    }
+};
+
+/**
+ * @brief Output manager writing casino simulation results to one container file per replication.
+ */
+using CasinoBinContainerOutputManager = BasicCasinoBinContainerOutputManager<ContainerOutputManager>;
+
+/**
+ * @brief Output manager appending casino simulation results to the segments of an archive.
+ */
+using CasinoBinArchiveOutputManager = BasicCasinoBinContainerOutputManager<ArchiveOutputManager>;
+
+/**
+ * @brief Manages readers for simulation results stored in a replication container.
+ */
+class CasinoBinContainerReplication : public ContainerReplication
+{
+public:
+    CasinoBinContainerReplication() : ContainerReplication() {}
+    CasinoBinContainerReplication(const std::string &name) : ContainerReplication(name) {}
+
+    /**
+     * @brief Registers a reader for each type of simulation result.
+     */
+    void init() override
+    {
+        registerStream<CasinoBinContainerReader>("ruleta_red");
+        registerStream<CasinoBinContainerReader>("ruleta_alt");
+        registerStream<CasinoBinContainerReader>("automat");
+        registerStream<CasinoBinContainerReader>("blackjack_con");
+        registerStream<CasinoBinContainerReader>("blackjack_agg");
+    }
 };
+
+/**
+ * @brief Input manager for handling multiple CasinoBinContainerReplication instances, stored as files or in an archive.
+ */
+class CasinoBinContainerInputManager : public InputManager<CasinoBinContainerReplication>
+{
+public:
+    CasinoBinContainerInputManager() = default;
+    CasinoBinContainerInputManager(const std::string &path) : InputManager(path) {}
+};
+
+/**
+ * @brief Manages readers for simulation results stored in raw column files.
+ */
+using CasinoBinRawReplication = BasicCasinoBinReplication<CasinoBinRawReader>;
+
+/**
+ * @brief Input manager for handling multiple CasinoBinRawReplication instances.
+ */
+using CasinoBinRawInputManager = BasicCasinoBinInputManager<CasinoBinRawReader>;
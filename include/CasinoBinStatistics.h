@@ -5,47 +5,93 @@
 #include "../lib/include/PresenterManager.h"
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <span>
+#include <vector>
+#include <memory>
+#include <functional>
 
 /**
  * @brief Collects and processes statistical data from binary casino simulation results.
+ * 
+ * @tparam IM The input manager of the replications.
+ * @tparam R The reader type registered by the replications for every game.
  */
-class CasinoBinStatistics : public Statistics<CasinoBinInputManager>
+template <typename IM, typename R>
+class BasicCasinoBinStatistics : public Statistics<IM>
 {
 private:
     std::vector<arma::vec> armaVecs; ///< Stores aggregated results for each game.
+    std::vector<double> blockValues; ///< Reusable buffer for values decoded block by block.
 
 public:
-    CasinoBinStatistics() : Statistics<CasinoBinInputManager>()
+    BasicCasinoBinStatistics() : Statistics<IM>()
     {
         armaVecs.resize(5, arma::vec());
     }
 
     /**
      * @brief Processes a single replication by reading data and appending it to internal vectors.
+     * 
+     * Readers of raw column files append their values with one bulk read straight into the
+     * vectors, readers of compressed blocks decode whole blocks into a buffer that is appended
+     * with one copy, other readers are loaded record by record.
+     * 
      * @param index Index of the replication to process.
      */
     void processReplication(size_t index) override
     {
-        auto rep = getInputManager().getReplication(index);
+        auto rep = this->getInputManager().getReplication(index);
 
         for (size_t i = 0; i < rep->getReaderCount(); i++)
         {
-            auto reader = rep->getReader<CasinoBinReader>(i);
-            reader->load();
-            auto &data = reader->getData();
+            auto reader = rep->template getReader<R>(i);
 
-            arma::vec convertedData(data.size());
-            for (size_t j = 0; j < data.size(); j++)
+            if constexpr (requires(R &r, std::span<double> destination) { r.readInto(destination); })
             {
-                convertedData(j) = data[j] ? *data[j] : 0.0;
+                if (i < armaVecs.size())
+                {
+                    arma::vec &values = armaVecs[i];
+                    size_t offset = values.n_elem;
+                    values.resize(offset + reader->size());
+                    size_t count = reader->readInto(std::span<double>(values.memptr() + offset, values.n_elem - offset));
+                    values.resize(offset + count);
+                }
+                reader->close();
             }
-
-            if (i < armaVecs.size())
+            else if constexpr (requires(R &r, std::vector<double> &destination) { r.readBlock(destination); })
             {
-                armaVecs[i] = arma::join_cols(armaVecs[i], convertedData);
+                if (i < armaVecs.size())
+                {
+                    blockValues.clear();
+                    while (reader->readBlock(blockValues) > 0)
+                    {
+                        // Every call appends one decoded block
+                    }
+
+                    arma::vec &values = armaVecs[i];
+                    size_t offset = values.n_elem;
+                    values.resize(offset + blockValues.size());
+                    std::copy(blockValues.begin(), blockValues.end(), values.memptr() + offset);
+                }
+                reader->close();
             }
+            else
+            {
+                reader->load();
+                const auto &data = reader->getData();
 
-            reader->flush();
+                // The values are contiguous, append them with one copy
+                if (i < armaVecs.size())
+                {
+                    arma::vec &values = armaVecs[i];
+                    size_t offset = values.n_elem;
+                    values.resize(offset + data.size());
+                    std::copy(data.begin(), data.end(), values.memptr() + offset);
+                }
+
+                reader->flush();
+            }
         }
     }
 
@@ -59,7 +105,7 @@ public:
             vec.clear();
         }
 
-        getInputManager().clearReplications();
+        this->getInputManager().clearReplications();
     }
 
     /**
@@ -67,7 +113,7 @@ public:
      * @param index Index of the game (0–4).
      * @return Mean of the recorded results, or 0.0 if empty or out of range.
      */
-    double getMean(size_t index) const
+    virtual double getMean(size_t index) const
     {
         if (index >= armaVecs.size() || armaVecs[index].empty())
         {
@@ -135,3 +181,136 @@ public:
         graphPresenter->setScale(0.0f, 100.0f);  // Scale from 0% to 100%
     }
 };
+
+/**
+ * @brief Statistics over casino simulation results stored by `CasinoBinOutputManager`.
+ */
+using CasinoBinStatistics = BasicCasinoBinStatistics<CasinoBinInputManager, CasinoBinReader>;
+
+/**
+ * @brief Statistics over casino simulation results stored by `CasinoBinOutputManager`, read on background threads.
+ */
+using CasinoBinPrefetchStatistics = BasicCasinoBinStatistics<CasinoBinPrefetchInputManager, CasinoBinReader>;
+
+/**
+ * @brief Statistics over casino simulation results stored in raw column files by `CasinoBinRawOutputManager`.
+ */
+using CasinoBinRawStatistics = BasicCasinoBinStatistics<CasinoBinRawInputManager, CasinoBinRawReader>;
+
+/**
+ * @brief Statistics over casino simulation results stored as compressed blocks by `CasinoBinGorillaOutputManager`.
+ */
+using CasinoBinGorillaStatistics = BasicCasinoBinStatistics<CasinoBinGorillaInputManager, CasinoBinGorillaReader>;
+
+/**
+ * @brief Computes the casino statistics in constant memory with a coroutine pipeline.
+ *
+ * Instead of loading every stream, each game is processed by a pipeline of generator
+ * stages: the reader decodes its records (`Reader::generate()`), an optional filter drops
+ * values (`setFilter()`), and an accumulate stage keeps the running sum and count. The
+ * pipelines of a replication are advanced in turn on one thread, only the means are kept.
+ *
+ * @tparam IM The input manager of the replications.
+ * @tparam R The reader type registered by the replications for every game.
+ */
+template <typename IM, typename R>
+class BasicCasinoBinStreamStatistics : public BasicCasinoBinStatistics<IM, R>
+{
+public:
+    /**
+     * @brief State of the accumulate stage of one game.
+     */
+    struct Accumulator
+    {
+        double sum = 0.0; ///< Sum of the accepted results.
+        size_t count = 0; ///< Number of the accepted results.
+    };
+
+private:
+    std::vector<double> sums;            ///< Sum of the results of each game.
+    std::vector<size_t> counts;          ///< Number of results of each game.
+    std::function<bool(double)> accepts; ///< Filter stage predicate, empty to keep every result.
+
+public:
+    BasicCasinoBinStreamStatistics() : sums(5, 0.0), counts(5, 0) {}
+
+    /**
+     * @brief Sets the predicate of the filter stage.
+     *
+     * @param predicate Called for every result, true keeps it; empty keeps every result.
+     */
+    void setFilter(std::function<bool(double)> predicate) { accepts = std::move(predicate); }
+
+    /**
+     * @brief Processes a single replication by streaming its records into the running sums.
+     *
+     * @param index Index of the replication to process.
+     */
+    void processReplication(size_t index) override
+    {
+        auto rep = this->getInputManager().getReplication(index);
+
+        std::vector<std::shared_ptr<R>> readers;
+        std::vector<Generator<Accumulator>> pipelines;
+        for (size_t i = 0; i < rep->getReaderCount(); i++)
+        {
+            readers.push_back(rep->template getReader<R>(i));
+            Generator<double> decoded = readers.back()->generate();
+            if (accepts)
+            {
+                decoded = std::move(decoded).filter(accepts);
+            }
+            pipelines.push_back(std::move(decoded).accumulate(Accumulator{}, [](Accumulator state, double value)
+                                                              {
+                                                                  state.sum += value;
+                                                                  ++state.count;
+                                                                  return state;
+                                                              }));
+        }
+
+        // Every game keeps the last state of its accumulate stage
+        std::vector<Accumulator> totals(pipelines.size());
+        Generator<Accumulator>::interleave(pipelines, [&totals](size_t game, const Accumulator &state)
+                                           { totals[game] = state; });
+        for (size_t game = 0; game < totals.size() && game < sums.size(); ++game)
+        {
+            sums[game] += totals[game].sum;
+            counts[game] += totals[game].count;
+        }
+
+        pipelines.clear();
+        for (auto &reader : readers)
+        {
+            reader->close();
+        }
+    }
+
+    /**
+     * @brief Clears all stored statistical data and loaded replications.
+     */
+    void clearData() override
+    {
+        std::fill(sums.begin(), sums.end(), 0.0);
+        std::fill(counts.begin(), counts.end(), 0);
+        BasicCasinoBinStatistics<IM, R>::clearData();
+    }
+
+    /**
+     * @brief Returns the mean value for a given game index.
+     * @param index Index of the game (0–4).
+     * @return Mean of the recorded results, or 0.0 if empty or out of range.
+     */
+    double getMean(size_t index) const override
+    {
+        if (index >= counts.size() || counts[index] == 0)
+        {
+            return 0.0;
+        }
+        return sums[index] / static_cast<double>(counts[index]);
+    }
+};
+
+/**
+ * @brief Streaming statistics over casino simulation results stored by `CasinoBinOutputManager`.
+ */
+using CasinoBinStreamStatistics = BasicCasinoBinStreamStatistics<CasinoBinInputManager, CasinoBinReader>;
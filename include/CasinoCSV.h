@@ -5,11 +5,16 @@
 #include "../lib/include/Writer.h"
 #include "../lib/include/Reader.h"
 #include "../lib/include/CSVFileOut.h"
+#include "../lib/include/BufferedCSVFileOut.h"
 #include "../lib/include/CSVFileIn.h"
+#include "../lib/include/BlockCSVFileIn.h"
 
 #include <string>
+#include <string_view>
+#include <charconv>
 #include <sstream>
 #include <iomanip>
+#include <span>
 
 class CasinoCSVConverter : public CSVConverter<double>
 {
@@ -26,20 +31,69 @@ public:
     {
         return std::stod(data);
     }
+
+    void encode(const double &data, std::string &out) override
+    {
+        char buffer[512];
+        out.assign(buffer, encode(data, std::span<char>(buffer)));
+    }
+
+    size_t encode(const double &data, std::span<char> out) override
+    {
+        // Same output as std::fixed with a precision of 2
+        auto [end, error] = std::to_chars(out.data(), out.data() + out.size(), data, std::chars_format::fixed, 2);
+        if (error != std::errc())
+        {
+            throw std::length_error("Buffer too small for encoded data");
+        }
+        return static_cast<size_t>(end - out.data());
+    }
+
+    double convert(std::string_view data)
+    {
+        return decode(data);
+    }
+
+    double decode(std::string_view data) override
+    {
+        // Accept what std::stod accepts: from_chars rejects leading whitespace and a plus sign
+        std::string_view value = data;
+        size_t first = value.find_first_not_of(" \t\n\v\f\r");
+        value.remove_prefix(first == std::string_view::npos ? value.size() : first);
+        if (value.size() > 1 && value[0] == '+' && value[1] != '+' && value[1] != '-')
+        {
+            value.remove_prefix(1);
+        }
+
+        double result = 0.0;
+        auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+        if (error != std::errc())
+        {
+            throw std::runtime_error(std::format("Invalid CSV value: {}", data));
+        }
+        return result;
+    }
 };
 
-class CasinoCSVWriter : public Writer<double, CasinoCSVConverter, CSVFileOut>
+class CasinoCSVWriter : public Writer<double, CasinoCSVConverter, BufferedCSVFileOut>
 {
 public:
     CasinoCSVWriter() : Writer() {}
     CasinoCSVWriter(const std::string &pFile) : Writer(pFile) {}
 };
 
-class CasinoCSVReader : public Reader<double, CasinoCSVConverter, CSVFileIn>
+class CasinoCSVReader : public Reader<double, CasinoCSVConverter, CSVFileIn, ContiguousStorage<double>>
 {
 public:
     CasinoCSVReader() : Reader() {}
     CasinoCSVReader(const std::string &pFile) : Reader(pFile) {}
 };
 
+class CasinoCSVBlockReader : public Reader<double, CasinoCSVConverter, BlockCSVFileIn, ContiguousStorage<double>>
+{
+public:
+    CasinoCSVBlockReader() : Reader() {}
+    CasinoCSVBlockReader(const std::string &pFile) : Reader(pFile) {}
+};
+
 #endif // __CASINOCSV_H__
\ No newline at end of file
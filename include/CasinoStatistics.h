@@ -6,6 +6,7 @@
 #include "../lib/include/PresenterManager.h"
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 
 class CasinoStatistics : public Statistics<CasinoInputManager>
 {
@@ -26,17 +27,15 @@ public:
         {
             auto reader = rep->getReader<CasinoCSVReader>(i);
             reader->load();
-            auto &data = reader->getData();
-
-            arma::vec convertedData(data.size());
-            for (size_t j = 0; j < data.size(); j++)
-            {
-                convertedData(j) = data[j] ? *data[j] : 0.0;
-            }
+            const auto &data = reader->getData();
 
+            // The values are contiguous, append them with one copy
             if (i < armaVecs.size())
             {
-                armaVecs[i] = arma::join_cols(armaVecs[i], convertedData);
+                arma::vec &values = armaVecs[i];
+                size_t offset = values.n_elem;
+                values.resize(offset + data.size());
+                std::copy(data.begin(), data.end(), values.memptr() + offset);
             }
 
             reader->flush();
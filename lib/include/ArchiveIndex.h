@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Crc32c.h"
+#include "LittleEndian.h"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <fstream>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+#include <type_traits>
+#include <format>
+
+/**
+ * @brief Central index of a replication archive.
+ *
+ * An archive stores replications as containers (see `ContainerFormat`) appended back to back
+ * to large segment files `segment-000000.seg`, `segment-000001.seg`, ... in the base path.
+ * The index `archive.idx` next to them maps every replication name to its segment and byte
+ * range, so replications are listed and opened without scanning the directory tree.
+ *
+ * The index is append-only, an entry is added once a replication has been fully written:
+ *
+ * [4 bytes magic]
+ * [entry: 2 bytes name length | name | 4 bytes segment | 8 bytes offset | 8 bytes size |
+ *  4 bytes CRC-32C of the preceding entry bytes]...
+ *
+ * Integers are little-endian. Loading stops at the first incomplete or corrupted entry, which
+ * is what an interrupted append leaves behind. When a name occurs more than once, the last
+ * entry wins.
+ */
+class ArchiveIndex
+{
+public:
+    static constexpr uint32_t Magic = 0x43524152;               ///< Marks an index file ("RARC").
+    static constexpr std::string_view FileName = "archive.idx"; ///< File name of the index.
+
+    /**
+     * @brief Location of a replication in the archive.
+     */
+    struct Entry
+    {
+        std::string name; ///< Name of the replication.
+        uint32_t segment; ///< Number of the segment file.
+        uint64_t offset;  ///< File offset of the container in the segment.
+        uint64_t size;    ///< Size of the container in bytes.
+    };
+
+private:
+    std::vector<Entry> entries;                     ///< Entries in the order they were appended.
+    std::unordered_map<std::string, size_t> lookup; ///< Position of the last entry of every name.
+    uint64_t validSize = 0;                         ///< Size of the valid part of the file in bytes.
+
+public:
+    /**
+     * @brief Gets the path of the index of an archive.
+     *
+     * @param basePath The base path of the archive, ending with a slash.
+     * @return The path of the index file.
+     */
+    static std::string pathFor(std::string_view basePath) { return std::format("{}{}", basePath, FileName); }
+
+    /**
+     * @brief Gets the path of a segment file of an archive.
+     *
+     * @param basePath The base path of the archive, ending with a slash.
+     * @param segment The number of the segment.
+     * @return The path of the segment file.
+     */
+    static std::string segmentPath(std::string_view basePath, uint32_t segment)
+    {
+        return std::format("{}segment-{:06}.seg", basePath, segment);
+    }
+
+    /**
+     * @brief Gets the entries in the order they were appended.
+     */
+    const std::vector<Entry> &getEntries() const { return entries; }
+
+    /**
+     * @brief Gets the size of the part of the file read by `load()`.
+     *
+     * Bytes beyond it are the remains of an interrupted append and must be truncated before
+     * appending further entries.
+     */
+    uint64_t getValidSize() const { return validSize; }
+
+    /**
+     * @brief Finds the entry of a replication.
+     *
+     * @param name The name of the replication.
+     * @return The last entry with that name, or nullptr if the archive has none.
+     */
+    const Entry *find(std::string_view name) const
+    {
+        auto it = lookup.find(std::string(name));
+        return it == lookup.end() ? nullptr : &entries[it->second];
+    }
+
+    /**
+     * @brief Reads an index file.
+     *
+     * @param file The path of the index file.
+     * @return True if the file was read, otherwise the index is left empty.
+     */
+    bool load(const std::string &file)
+    {
+        entries.clear();
+        lookup.clear();
+        validSize = 0;
+
+        std::ifstream in(file, std::ios::binary | std::ios::in);
+        if (!in)
+        {
+            return false;
+        }
+        std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        uint32_t magic = 0;
+        if (buffer.size() < sizeof(magic))
+        {
+            return false;
+        }
+        magic = LittleEndian::load<uint32_t>(buffer.data());
+        if (magic != Magic)
+        {
+            return false;
+        }
+
+        size_t position = sizeof(magic);
+        validSize = position;
+        while (position < buffer.size())
+        {
+            size_t start = position;
+            auto get = [&](auto &value)
+            {
+                if (buffer.size() - position < sizeof(value))
+                {
+                    return false;
+                }
+                value = LittleEndian::load<std::remove_cvref_t<decltype(value)>>(buffer.data() + position);
+                position += sizeof(value);
+                return true;
+            };
+
+            Entry entry;
+            uint16_t nameSize;
+            uint32_t crc;
+            if (!get(nameSize) || buffer.size() - position < nameSize)
+            {
+                break;
+            }
+            entry.name.assign(reinterpret_cast<const char *>(buffer.data() + position), nameSize);
+            position += nameSize;
+            if (!get(entry.segment) || !get(entry.offset) || !get(entry.size))
+            {
+                break;
+            }
+            uint32_t expected = Crc32c::compute(buffer.data() + start, position - start);
+            if (!get(crc) || crc != expected)
+            {
+                break;
+            }
+
+            lookup[entry.name] = entries.size();
+            entries.push_back(std::move(entry));
+            validSize = position;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Appends an entry to an index file, creating the file if needed.
+     *
+     * @param file The path of the index file.
+     * @param entry The entry to append.
+     * @throws std::runtime_error If the name is too long or writing fails.
+     */
+    static void append(const std::string &file, const Entry &entry)
+    {
+        if (entry.name.size() > std::numeric_limits<uint16_t>::max())
+        {
+            throw std::runtime_error(std::format("Replication name too long: {}", entry.name));
+        }
+
+        std::vector<uint8_t> buffer;
+        auto put = [&buffer](auto value)
+        {
+            uint8_t bytes[sizeof(value)];
+            LittleEndian::store(bytes, value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+        };
+
+        std::error_code error;
+        if (std::filesystem::file_size(file, error) == 0 || error)
+        {
+            put(Magic);
+        }
+        size_t start = buffer.size();
+        put(static_cast<uint16_t>(entry.name.size()));
+        buffer.insert(buffer.end(), entry.name.begin(), entry.name.end());
+        put(entry.segment);
+        put(entry.offset);
+        put(entry.size);
+        put(Crc32c::compute(buffer.data() + start, buffer.size() - start));
+
+        std::ofstream out(file, std::ios::binary | std::ios::out | std::ios::app);
+        out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        out.flush();
+        if (!out)
+        {
+            throw std::runtime_error(std::format("Failed to write file: {}", file));
+        }
+    }
+};
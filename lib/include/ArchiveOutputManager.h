@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ContainerOutputManager.h"
+#include "ArchiveIndex.h"
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Output manager appending every replication to the segments of an archive.
+ *
+ * Works like `ContainerOutputManager`, but instead of a file per replication the containers
+ * are appended to large segment files, and every finished replication is recorded in the
+ * central index of the archive (see `ArchiveIndex`). A new segment is started once the
+ * current one reaches the segment size. Writing continues an existing archive in the base
+ * path; partially written data of an interrupted run is not listed in the index and ignored.
+ */
+class ArchiveOutputManager : public ContainerOutputManager
+{
+public:
+    static constexpr uint64_t DefaultSegmentSize = 1ull << 30; ///< Default size of a segment in bytes (1 GiB).
+
+private:
+    uint64_t segmentSize = DefaultSegmentSize; ///< Size after which a new segment is started.
+    uint32_t segment = 0;                      ///< Number of the current segment.
+    bool resumed = false;                      ///< Flag indicating whether the existing index was read.
+
+public:
+    ArchiveOutputManager() : ContainerOutputManager() {}
+    ArchiveOutputManager(const std::string &path) : ContainerOutputManager(path) {}
+
+    /**
+     * @brief Closes all writers and records the current replication in the index.
+     */
+    ~ArchiveOutputManager() override { closeAllWriters(); }
+
+    /**
+     * @brief Gets the size after which a new segment is started.
+     */
+    uint64_t getSegmentSize() const { return segmentSize; }
+
+    /**
+     * @brief Sets the size after which a new segment is started.
+     *
+     * @param size The segment size in bytes, a replication is never split between segments.
+     */
+    void setSegmentSize(uint64_t size) { segmentSize = size > 0 ? size : DefaultSegmentSize; }
+
+    /**
+     * @brief Closes all registered writers and the container, then records the replication in the index.
+     *
+     * A container that could not be written completely is left out of the index.
+     */
+    void closeAllWriters() noexcept override
+    {
+        auto container = getContainer();
+        bool open = container && container->isOpen();
+        OutputManager::closeAllWriters();
+        if (!open)
+        {
+            return;
+        }
+        if (!closeContainer())
+        {
+            std::cerr << "Warning: Replication " << getCurrentReplicationName() << " not added to archive index" << std::endl;
+            return;
+        }
+
+        try
+        {
+            ArchiveIndex::append(ArchiveIndex::pathFor(getBasePath()),
+                                 {getCurrentReplicationName(), segment, container->getBaseOffset(), container->getSize()});
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: Failed to update archive index: " << e.what() << std::endl;
+        }
+    }
+
+protected:
+    /**
+     * @brief Appends the container of the current replication to the current segment.
+     *
+     * @throws std::runtime_error If the segment cannot be opened.
+     */
+    void createReplicationStorage() override
+    {
+        if (!resumed)
+        {
+            resume();
+        }
+
+        std::string path = ArchiveIndex::segmentPath(getBasePath(), segment);
+        std::error_code error;
+        if (std::filesystem::file_size(path, error) >= segmentSize && !error)
+        {
+            path = ArchiveIndex::segmentPath(getBasePath(), ++segment);
+        }
+        openContainer(path, true);
+    }
+
+private:
+    /**
+     * @brief Continues the archive in the base path, if there is one.
+     *
+     * Starts in the last segment listed in the index and truncates the index after its
+     * last valid entry.
+     */
+    void resume()
+    {
+        std::string indexPath = ArchiveIndex::pathFor(getBasePath());
+        ArchiveIndex index;
+        if (index.load(indexPath))
+        {
+            if (!index.getEntries().empty())
+            {
+                segment = index.getEntries().back().segment;
+            }
+            if (std::filesystem::file_size(indexPath) > index.getValidSize())
+            {
+                std::filesystem::resize_file(indexPath, index.getValidSize());
+            }
+        }
+        resumed = true;
+    }
+};
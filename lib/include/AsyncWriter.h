@@ -0,0 +1,340 @@
+#pragma once
+
+#include "SpscQueue.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <ranges>
+#include <stdexcept>
+#include <iostream>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Behaviour of `AsyncWriter` when its queue is full.
+ */
+enum class BackpressurePolicy
+{
+    BLOCK, ///< Wait until the I/O thread frees a slot, no record is lost.
+    DROP   ///< Discard the record and count it, the caller never waits.
+};
+
+/**
+ * @brief Concept for writers whose file handler must be used by a single thread.
+ *
+ * File handlers tied to the thread that opened them (e.g. `UringBinFileOut`, which submits
+ * to that thread's ring) declare `static constexpr bool ThreadAffine = true`.
+ *
+ * @tparam W The writer type, providing `getFile()`.
+ */
+template <typename W>
+concept ThreadAffineWriter = requires(W &writer) {
+    requires std::remove_cvref_t<decltype(writer.getFile())>::ThreadAffine;
+};
+
+/**
+ * @brief Writer adapter that hands records to a dedicated I/O thread.
+ *
+ * The adapter derives from a writer type and replaces its `write()`: records are pushed into
+ * a lock-free `SpscQueue`, and an I/O thread started on the first write pops them and writes
+ * them with the writer's own `write()`. The calling thread therefore does not wait for the
+ * disk; with `BackpressurePolicy::DROP` it does not wait at all, and records that do not fit
+ * into the queue are counted by `getDroppedCount()`.
+ *
+ * `flush()` waits until the queued records are written and then flushes the writer, `close()`
+ * also waits for them and then closes the writer. The I/O thread and its queue are kept
+ * until the adapter is destroyed, so a writer retargeted with `setPath()` (e.g. by a pooled
+ * `OutputManager`) starts the next file without allocating. Only one thread may write to the
+ * adapter. A failure of the I/O thread is rethrown by the next `write()` or `flush()`, later
+ * records are discarded until the writer is closed. The file is opened by the I/O thread
+ * but closed by the caller, so file handlers that must stay on one thread
+ * (`ThreadAffineWriter`) are rejected.
+ *
+ * @tparam W The writer type, providing `DataType` and `write(const DataType &)`.
+ */
+template <typename W>
+class AsyncWriter : public W
+{
+    static_assert(!ThreadAffineWriter<W>, "AsyncWriter writes on an I/O thread, the file handler must not be thread-affine");
+
+public:
+    using DataType = typename W::DataType; ///< Type of the written records.
+
+    static constexpr size_t DefaultCapacity = 65536; ///< Default number of queued records.
+
+private:
+    size_t capacity = DefaultCapacity;                     ///< Number of records the queue holds.
+    BackpressurePolicy policy = BackpressurePolicy::BLOCK; ///< Behaviour when the queue is full.
+    std::unique_ptr<SpscQueue<DataType>> queue;            ///< Records waiting for the I/O thread.
+    std::thread worker;                                    ///< I/O thread.
+    uint64_t pushed = 0;                                   ///< Number of queued records, used by the writing thread.
+    std::atomic<uint64_t> completed{0};                    ///< Number of records taken from the queue.
+    std::atomic<uint64_t> dropped{0};                      ///< Number of discarded records.
+
+    std::mutex mutex;                  ///< Protects sleeping of the I/O thread.
+    std::condition_variable wakeup;    ///< Wakes the I/O thread.
+    std::atomic<bool> sleeping{false}; ///< Whether the I/O thread waits for records.
+    std::atomic<bool> stopping{false}; ///< Whether the I/O thread should finish.
+    std::atomic<bool> failed{false};   ///< Whether the I/O thread failed.
+    std::exception_ptr error;          ///< Failure of the I/O thread.
+
+public:
+    using W::W;
+
+    /**
+     * @brief Destructor that writes the queued records and stops the I/O thread.
+     */
+    ~AsyncWriter() override { stop(); }
+
+    /**
+     * @brief Configures the queue.
+     *
+     * A changed capacity stops a running I/O thread after it wrote the queued records, the
+     * next write starts it with a new queue.
+     *
+     * @param size The number of records the queue holds, rounded up to a power of two.
+     * @param backpressure The behaviour when the queue is full.
+     */
+    void setQueue(size_t size, BackpressurePolicy backpressure)
+    {
+        capacity = size > 0 ? size : DefaultCapacity;
+        policy = backpressure;
+        if (queue && queue->capacity() != SpscQueue<DataType>::slotsFor(capacity))
+        {
+            stop();
+        }
+    }
+
+    /**
+     * @brief Gets the number of records discarded because the queue was full.
+     */
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Queues a single record for the I/O thread.
+     *
+     * @param data The record to write.
+     * @throws std::runtime_error If the I/O thread failed.
+     */
+    void write(const DataType &data)
+    {
+        if (failed.load(std::memory_order_acquire))
+        {
+            rethrow();
+        }
+        if (!worker.joinable())
+        {
+            start();
+        }
+
+        while (!queue->tryPush(data))
+        {
+            if (policy == BackpressurePolicy::DROP)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            wake();
+            queue->waitForSpace();
+        }
+        ++pushed;
+        wake();
+    }
+
+    /**
+     * @brief Queues a range of records for the I/O thread.
+     *
+     * @param dataRange The records to write.
+     * @throws std::runtime_error If the I/O thread failed.
+     */
+    template <std::ranges::range Range>
+    void write(const Range &dataRange)
+    {
+        for (const DataType &item : dataRange)
+        {
+            write(item);
+        }
+    }
+
+    /**
+     * @brief Waits until the queued records are written and flushes the writer.
+     *
+     * @throws std::runtime_error If the I/O thread failed.
+     */
+    void flush() override
+    {
+        drain();
+        if (failed.load(std::memory_order_acquire))
+        {
+            rethrow();
+        }
+        W::flush();
+    }
+
+    /**
+     * @brief Waits until the queued records are written and closes the writer.
+     *
+     * The I/O thread keeps running, idle, until the next write or the destruction of the adapter.
+     * A failure of the I/O thread is reported as a warning and cleared.
+     */
+    void close() override
+    {
+        drain(true);
+        reportFailure();
+        W::close();
+    }
+
+    /**
+     * @brief Closes the writer and retargets it at another file, keeping the I/O thread and its queue.
+     *
+     * @param pFile The path of the new file, opened by the I/O thread on the next write.
+     */
+    void setPath(const std::string &pFile) override
+    {
+        close();
+        W::setPath(pFile);
+    }
+
+private:
+    /**
+     * @brief Starts the I/O thread, reusing the queue if its capacity did not change.
+     */
+    void start()
+    {
+        if (!queue || queue->capacity() != SpscQueue<DataType>::slotsFor(capacity))
+        {
+            queue = std::make_unique<SpscQueue<DataType>>(capacity);
+        }
+        pushed = 0;
+        completed.store(0, std::memory_order_relaxed);
+        stopping.store(false, std::memory_order_relaxed);
+        worker = std::thread([this] { run(); });
+    }
+
+    /**
+     * @brief Lets the I/O thread write the queued records and waits for it to end.
+     */
+    void stop() noexcept
+    {
+        if (!worker.joinable())
+        {
+            return;
+        }
+        {
+            std::lock_guard lock(mutex);
+            stopping.store(true, std::memory_order_seq_cst);
+        }
+        wakeup.notify_one();
+        worker.join();
+        reportFailure();
+    }
+
+    /**
+     * @brief Reports and clears a failure of the I/O thread, which must be idle.
+     */
+    void reportFailure() noexcept
+    {
+        if (failed.exchange(false))
+        {
+            try
+            {
+                std::rethrow_exception(std::exchange(error, {}));
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Warning: Failed to write queued records: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    /**
+     * @brief Waits until the I/O thread took every queued record.
+     *
+     * @param idle If true, also waits after a failure, until the I/O thread discarded the
+     *             remaining records and no longer touches the writer.
+     */
+    void drain(bool idle = false)
+    {
+        if (!worker.joinable())
+        {
+            return;
+        }
+        wake();
+        uint64_t done = completed.load(std::memory_order_acquire);
+        while (done < pushed && (idle || !failed.load(std::memory_order_acquire)))
+        {
+            completed.wait(done, std::memory_order_acquire);
+            done = completed.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Wakes the I/O thread if it waits for records.
+     */
+    void wake()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_seq_cst))
+        {
+            std::lock_guard lock(mutex);
+            wakeup.notify_one();
+        }
+    }
+
+    /**
+     * @brief Rethrows the failure of the I/O thread.
+     */
+    [[noreturn]] void rethrow()
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        throw std::runtime_error("Failed to write queued records");
+    }
+
+    /**
+     * @brief Body of the I/O thread, writes queued records until stopped.
+     */
+    void run()
+    {
+        DataType record{};
+        while (true)
+        {
+            while (queue->tryPop(record))
+            {
+                if (!failed.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        W::write(record);
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                        failed.store(true, std::memory_order_release);
+                    }
+                }
+                completed.fetch_add(1, std::memory_order_release);
+                completed.notify_one();
+            }
+
+            std::unique_lock lock(mutex);
+            sleeping.store(true, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (queue->empty())
+            {
+                if (stopping.load(std::memory_order_seq_cst))
+                {
+                    sleeping.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                wakeup.wait(lock, [this] { return !queue->empty() || stopping.load(std::memory_order_seq_cst); });
+            }
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+};
@@ -3,6 +3,9 @@
 #include "Converter.h"
 #include <vector>
 #include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <algorithm>
 
 /**
  * @brief Abstract class for binary data conversion.
@@ -37,4 +40,42 @@ public:
      * @return The converted data of type `T`.
      */
     T convert(const OutputType &data) override = 0;
+
+    using Converter<T, OutputType>::encode;
+
+    /**
+     * @brief Encodes data of type `T` into a caller-provided buffer.
+     * 
+     * Derived classes with a fixed-size format override this function to write the bytes
+     * directly. The default implementation copies the result of `convert()`.
+     * 
+     * @param data The input data of type `T`.
+     * @param out The buffer receiving the binary data.
+     * @return The number of bytes written.
+     * @throws std::length_error If the buffer is too small.
+     */
+    virtual size_t encode(const T &data, std::span<uint8_t> out)
+    {
+        OutputType bytes = this->convert(data);
+        if (bytes.size() > out.size())
+        {
+            throw std::length_error("Buffer too small for encoded data");
+        }
+        std::copy(bytes.begin(), bytes.end(), out.begin());
+        return bytes.size();
+    }
+
+    /**
+     * @brief Decodes binary data from a view.
+     * 
+     * Lets readers decode records returned as views (e.g. by `MappedBinFileIn`) without
+     * copying them. The default implementation copies the bytes and calls `convert()`.
+     * 
+     * @param data A view of the binary data.
+     * @return The converted data of type `T`.
+     */
+    virtual T decode(std::span<const uint8_t> data)
+    {
+        return this->convert(OutputType(data.begin(), data.end()));
+    }
 };
\ No newline at end of file
@@ -1,19 +1,36 @@
 #pragma once
 
 #include "FileIn.h"
+#include "RecordIndex.h"
+#include "BlockChecksums.h"
 #include <fstream>
 #include <vector>
 #include <cstdint>
 #include <format>
+#include <filesystem>
 
 /**
  * @brief Class for reading binary data from a file.
  * 
  * This class inherits from `FileIn` and implements reading operations for binary files,
  * returning data as a vector of bytes.
+ *
+ * A sidecar `RecordIndex` written by `BinFileOut` is loaded on `open()` and lets `seek()`
+ * jump close to any record. Without it, `seek()` skips records from the start of the file.
+ *
+ * Sidecar `BlockChecksums` are loaded on `open()` as well; every block is then verified
+ * once it has been read completely, and a file shorter than its checksums is rejected.
+ * Checksums left behind by an older version of the file are ignored.
  */
 class BinFileIn : public FileIn<std::vector<uint8_t>>
 {
+private:
+    RecordIndex index;        ///< Offset index of the open file.
+    BlockChecksums checksums; ///< Block checksums of the open file.
+    uint64_t readOffset = 0;  ///< File offset of the next record.
+    bool indexed = false;     ///< Flag indicating whether a matching index was loaded.
+    bool verified = false;    ///< Flag indicating whether reads are verified against checksums.
+
 public:
     /**
      * @brief Opens a binary file for reading.
@@ -29,6 +46,25 @@ public:
         {
             throw std::runtime_error(std::format("Failed to open file: {}", file));
         }
+
+        std::error_code error;
+        uint64_t size = std::filesystem::file_size(file, error);
+        indexed = !error && index.load(RecordIndex::pathFor(file), size, RecordIndex::modificationTime(file));
+        readOffset = 0;
+
+        try
+        {
+            verified = checksums.load(BlockChecksums::pathFor(file), RecordIndex::modificationTime(file));
+            if (verified && (error || checksums.getDataSize() != size))
+            {
+                throw std::runtime_error(std::format("File size does not match its checksums: {}", file));
+            }
+        }
+        catch (const std::exception &)
+        {
+            close();
+            throw;
+        }
     }
 
     /**
@@ -40,6 +76,86 @@ public:
         {
             inFile.close();
         }
+        indexed = false;
+        verified = false;
+    }
+
+    /**
+     * @brief Checks whether reads are verified against sidecar checksums.
+     *
+     * @return True if checksums were loaded on `open()`.
+     */
+    bool hasChecksums() const { return verified; }
+
+    /**
+     * @brief Checks whether a sidecar offset index is used.
+     *
+     * @return True if a matching index was loaded on `open()`.
+     */
+    bool hasIndex() const { return indexed; }
+
+    /**
+     * @brief Moves the read position to a record.
+     *
+     * Positions past the last record leave the file at its end.
+     *
+     * @param record The index of the record read next.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    void seek(uint64_t record)
+    {
+        if (!inFile.is_open())
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        auto [offset, skip] = index.locate(record);
+        inFile.clear();
+        inFile.seekg(static_cast<std::streamoff>(offset));
+        while (skip-- > 0 && skipRecord())
+        {
+        }
+
+        // Past the last record, the next read reports the end of the file
+        if (!inFile)
+        {
+            inFile.clear();
+            inFile.seekg(0, std::ios::end);
+        }
+        readOffset = static_cast<uint64_t>(inFile.tellg());
+    }
+
+    /**
+     * @brief Gets the number of records in the file.
+     *
+     * Taken from the index if available, otherwise the records are counted without
+     * reading their content. The read position is not affected.
+     *
+     * @return The number of records.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    uint64_t recordCount()
+    {
+        if (!inFile.is_open())
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+        if (indexed)
+        {
+            return index.getRecordCount();
+        }
+
+        inFile.clear();
+        std::streampos position = inFile.tellg();
+        inFile.seekg(0);
+        uint64_t count = 0;
+        while (skipRecord())
+        {
+            ++count;
+        }
+        inFile.clear();
+        inFile.seekg(position);
+        return count;
     }
 
     /**
@@ -59,6 +175,7 @@ public:
 
         // Read size in a portable way (little-endian, fixed 4 bytes)
         uint32_t dataSize = 0;
+        uint8_t header[sizeof(dataSize)];
         for (size_t i = 0; i < sizeof(dataSize); ++i)
         {
             uint8_t byte;
@@ -71,6 +188,7 @@ public:
             {
                 throw std::runtime_error("Failed to read data size");
             }
+            header[i] = byte;
             dataSize |= static_cast<uint32_t>(byte) << (i * 8);
         }
 
@@ -84,6 +202,41 @@ public:
         {
             throw std::runtime_error("Failed to read data content");
         }
+
+        if (verified)
+        {
+            if (static_cast<size_t>(inFile.gcount()) != dataSize)
+            {
+                throw std::runtime_error("Failed to read data content");
+            }
+            checksums.check(readOffset, header, sizeof(header));
+            checksums.check(readOffset + sizeof(header), buffer.data(), buffer.size());
+        }
+        readOffset += sizeof(header) + dataSize;
         return buffer;
     }
+
+private:
+    /**
+     * @brief Moves the read position past the next record without reading its content.
+     *
+     * @return False at the end of the file.
+     */
+    bool skipRecord()
+    {
+        uint8_t header[sizeof(uint32_t)];
+        inFile.read(reinterpret_cast<char *>(header), sizeof(header));
+        if (inFile.gcount() != sizeof(header))
+        {
+            return false;
+        }
+
+        uint32_t dataSize = 0;
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            dataSize |= static_cast<uint32_t>(header[i]) << (i * 8);
+        }
+        inFile.seekg(dataSize, std::ios::cur);
+        return static_cast<bool>(inFile);
+    }
 };
\ No newline at end of file
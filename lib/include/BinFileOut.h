@@ -1,68 +1,331 @@
 #pragma once
 
 #include "FileOut.h"
+#include "RecordIndex.h"
+#include "BlockChecksums.h"
 #include <cstdint>
 #include <fstream>
 #include <vector>
+#include <span>
+#include <cstring>
 #include <format>
+#include <filesystem>
+#include <iostream>
 
 /**
  * @brief Class for writing binary data to a file.
- * 
+ *
  * This class inherits from `FileOut` and implements writing operations for binary files,
  * storing data as a vector of bytes.
+ *
+ * Every record (size prefix and data content) is serialised into a contiguous staging
+ * buffer and handed to the stream in one call. With a non-zero buffer size the records
+ * are batched and the buffer is only written out once it reaches that size, on `flush()`
+ * or on `close()`. A failed write of the buffer is reported by `write()`, `writeBatch()`
+ * and `flush()`, and as a warning by `close()`.
+ *
+ * With a non-zero index interval the file handler also records the offset of every
+ * k-th record and writes them to a sidecar `RecordIndex` on `close()`, which lets
+ * readers seek to any record.
+ *
+ * With a non-zero checksum block size, CRC-32C checksums of fixed-size blocks of the file
+ * are written to a sidecar `BlockChecksums` file on `close()` and verified by `BinFileIn`.
  */
 class BinFileOut : public FileOut<std::vector<uint8_t>>
 {
 public:
+    static constexpr size_t DefaultBufferSize = 64 * 1024; ///< Recommended size for buffered mode.
+
+private:
+    std::vector<uint8_t> buffer;    ///< Staging buffer holding serialised records.
+    size_t bufferSize = 0;          ///< Number of bytes collected before the buffer is written out (0 = write every record).
+    RecordIndex index;              ///< Offset index of the records written so far.
+    std::string filePath;           ///< Path of the open file.
+    uint64_t fileOffset = 0;        ///< File offset of the next record.
+    uint32_t indexInterval = 0;     ///< Number of records between indexed records (0 = no index).
+    BlockChecksums checksums;       ///< Checksums of the bytes written so far.
+    std::string checksumPath;       ///< Path of the sidecar checksum file (empty = no checksums).
+    uint32_t checksumBlockSize = 0; ///< Number of bytes per checksummed block (0 = no checksums).
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The staging buffer size in bytes, 0 writes every record immediately.
+     */
+    explicit BinFileOut(size_t size = 0) { setBufferSize(size); }
+
+    /**
+     * @brief Destructor that ensures buffered records are written out.
+     */
+    ~BinFileOut() { close(); }
+
+    /**
+     * @brief Gets the staging buffer size.
+     *
+     * @return The buffer size in bytes.
+     */
+    size_t getBufferSize() const { return bufferSize; }
+
+    /**
+     * @brief Sets the staging buffer size.
+     *
+     * Records already in the buffer are kept and written out with the next flush.
+     *
+     * @param size The buffer size in bytes, 0 writes every record immediately.
+     */
+    void setBufferSize(size_t size)
+    {
+        bufferSize = size;
+        buffer.reserve(size);
+    }
+
+    /**
+     * @brief Sets the number of records between entries of the sidecar offset index.
+     *
+     * Takes effect on the next `open()`.
+     *
+     * @param interval The number of records between indexed records, 0 disables the index.
+     */
+    void setIndexInterval(uint32_t interval) { indexInterval = interval; }
+
+    /**
+     * @brief Gets the number of records between entries of the sidecar offset index.
+     *
+     * @return The index interval, 0 if no index is written.
+     */
+    uint32_t getIndexInterval() const { return indexInterval; }
+
+    /**
+     * @brief Sets the block size of the sidecar checksums.
+     *
+     * Takes effect on the next `open()`.
+     *
+     * @param size The number of bytes per checksummed block, 0 disables checksums.
+     */
+    void setChecksumBlockSize(uint32_t size) { checksumBlockSize = size; }
+
+    /**
+     * @brief Gets the block size of the sidecar checksums.
+     *
+     * @return The number of bytes per checksummed block, 0 if no checksums are written.
+     */
+    uint32_t getChecksumBlockSize() const { return checksumBlockSize; }
+
     /**
      * @brief Opens a binary file for writing.
-     * 
+     *
+     * The file is created if it does not exist and truncated otherwise.
+     *
      * @param file The path to the binary file to open.
      * @throws std::runtime_error If the file cannot be opened.
      */
     void open(const std::string_view file) override
     {
         close();
-        outFile.open(file.data(), std::ios::binary | std::ios::in);
+        outFile.open(file.data(), std::ios::binary | std::ios::out | std::ios::trunc);
         if (!outFile)
         {
             throw std::runtime_error(std::format("Failed to open file: {}", file));
         }
+
+        fileOffset = 0;
+        index = RecordIndex(indexInterval);
+        filePath = file;
+
+        checksums = BlockChecksums(checksumBlockSize);
+        checksumPath = BlockChecksums::pathFor(file);
+        if (checksumBlockSize == 0)
+        {
+            // Checksums of a previous version of the file would report it as corrupted
+            std::error_code error;
+            std::filesystem::remove(checksumPath, error);
+            checksumPath.clear();
+        }
     }
 
     /**
      * @brief Closes the currently open binary file.
+     *
+     * Buffered records are written out before the file is closed, followed by the
+     * sidecar offset index and checksums if enabled.
      */
     void close() noexcept override
     {
         if (outFile.is_open())
         {
+            try
+            {
+                flush();
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Warning: " << e.what() << std::endl;
+            }
             outFile.close();
+
+            // Taken after closing, so that the sidecar files record the final modification time
+            int64_t modified = RecordIndex::modificationTime(filePath);
+            if (index.getInterval() > 0)
+            {
+                try
+                {
+                    index.save(RecordIndex::pathFor(filePath), modified);
+                }
+                catch (const std::exception &)
+                {
+                    // Readers fall back to sequential scans without an index
+                }
+            }
+            if (!checksumPath.empty())
+            {
+                try
+                {
+                    checksums.save(checksumPath, modified);
+                }
+                catch (const std::exception &)
+                {
+                    // close() cannot report errors, the file is then read without verification
+                }
+            }
         }
+        filePath.clear();
+        checksumPath.clear();
+        buffer.clear();
     }
 
     /**
      * @brief Writes binary data to the file.
-     * 
+     *
      * Writes the size of the data (4 bytes, little-endian) followed by the actual data content.
-     * 
+     *
      * @param data The vector of bytes to write to the file.
-     * @throws std::runtime_error If the file is not open for writing.
+     * @throws std::runtime_error If the file is not open for writing or writing the buffer fails.
      */
     void write(const std::vector<uint8_t>& data) override {
-        if (!outFile) {
-            throw std::runtime_error("Failed to open file for writing");
-        }
-    
+        checkStream();
+
         // Write size in a portable way (little-endian, fixed 4 bytes)
+        size_t recordStart = buffer.size();
         uint32_t dataSize = static_cast<uint32_t>(data.size()); // Použijeme 4-bajtový typ
         for (size_t i = 0; i < sizeof(dataSize); ++i) {
-            uint8_t byte = static_cast<uint8_t>(dataSize >> (i * 8));
-            outFile.write(reinterpret_cast<const char*>(&byte), 1);
+            buffer.push_back(static_cast<uint8_t>(dataSize >> (i * 8)));
+        }
+
+        // Stage the actual data behind its size
+        buffer.insert(buffer.end(), data.begin(), data.end());
+
+        if (!checksumPath.empty()) {
+            checksums.update(buffer.data() + recordStart, buffer.size() - recordStart);
+        }
+
+        if (index.getInterval() > 0) {
+            index.add(fileOffset, sizeof(dataSize) + data.size());
+        }
+        fileOffset += sizeof(dataSize) + data.size();
+
+        if (buffer.size() >= bufferSize) {
+            writeBuffer();
+        }
+    }
+
+    /**
+     * @brief Writes several records to the file.
+     *
+     * All records are framed into the staging buffer in one pass, their checksums are
+     * updated once, and the buffer is written out at most once for the whole batch.
+     *
+     * @param records The records to write, in order.
+     * @throws std::runtime_error If the file is not open for writing or writing the buffer fails.
+     */
+    void writeBatch(std::span<const std::vector<uint8_t>> records) override {
+        checkStream();
+
+        size_t batchStart = buffer.size();
+        size_t batchSize = 0;
+        for (const auto &data : records) {
+            batchSize += sizeof(uint32_t) + data.size();
+        }
+        buffer.resize(batchStart + batchSize);
+
+        uint8_t *out = buffer.data() + batchStart;
+        for (const auto &data : records) {
+            // Write size in a portable way (little-endian, fixed 4 bytes)
+            uint32_t dataSize = static_cast<uint32_t>(data.size());
+            for (size_t i = 0; i < sizeof(dataSize); ++i) {
+                *out++ = static_cast<uint8_t>(dataSize >> (i * 8));
+            }
+            if (!data.empty()) {
+                std::memcpy(out, data.data(), data.size());
+            }
+            out += data.size();
+
+            if (index.getInterval() > 0) {
+                index.add(fileOffset, sizeof(dataSize) + data.size());
+            }
+            fileOffset += sizeof(dataSize) + data.size();
+        }
+
+        if (!checksumPath.empty()) {
+            checksums.update(buffer.data() + batchStart, batchSize);
+        }
+
+        if (buffer.size() >= bufferSize) {
+            writeBuffer();
+        }
+    }
+
+    /**
+     * @brief Writes buffered records out and flushes the stream.
+     *
+     * @throws std::runtime_error If writing the buffer fails.
+     */
+    void flush() override
+    {
+        if (outFile.is_open())
+        {
+            writeBuffer();
+            outFile.flush();
+            if (!outFile)
+            {
+                throw std::runtime_error("Failed to write data block");
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Checks that the file is open and no earlier write of the buffer failed.
+     *
+     * @throws std::runtime_error If the file is not open or the stream failed.
+     */
+    void checkStream() const
+    {
+        if (!outFile.is_open())
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+        if (!outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+    }
+
+    /**
+     * @brief Hands the staging buffer to the stream in a single call and empties it.
+     *
+     * @throws std::runtime_error If the stream fails to write the buffer.
+     */
+    void writeBuffer()
+    {
+        if (!buffer.empty())
+        {
+            outFile.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+            buffer.clear();
+            if (!outFile)
+            {
+                throw std::runtime_error("Failed to write data block");
+            }
         }
-    
-        // Write the actual data
-        outFile.write(reinterpret_cast<const char*>(data.data()), data.size());
     }
-};
\ No newline at end of file
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "FileIn.h"
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <span>
+#include <format>
+
+/**
+ * @brief Class for reading length-prefixed binary data in large blocks.
+ *
+ * This class inherits from `FileIn` and reads the same format as `BinFileIn`
+ * (4-byte little-endian size followed by the data content). Instead of issuing
+ * stream reads per record it fills a reusable buffer with large blocks and parses
+ * the records out of it. Records straddling two blocks are moved to the front of
+ * the buffer before the next block is appended; records larger than a block grow
+ * the buffer.
+ *
+ * A returned view stays valid until the next call to `read()`.
+ */
+class BlockBinFileIn : public FileIn<std::span<const uint8_t>>
+{
+public:
+    static constexpr size_t DefaultBlockSize = 1024 * 1024; ///< Default number of bytes read per block.
+
+private:
+    std::vector<uint8_t> buffer; ///< Reusable buffer holding the current block.
+    size_t blockSize;            ///< Number of bytes requested from the stream per read.
+    size_t begin = 0;            ///< Offset of the first unparsed byte in the buffer.
+    size_t end = 0;              ///< Offset one past the last valid byte in the buffer.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of bytes read per block.
+     */
+    explicit BlockBinFileIn(size_t size = DefaultBlockSize) : blockSize(size > 0 ? size : DefaultBlockSize) {}
+
+    /**
+     * @brief Gets the block size.
+     *
+     * @return The number of bytes read per block.
+     */
+    size_t getBlockSize() const { return blockSize; }
+
+    /**
+     * @brief Sets the block size used for subsequent reads.
+     *
+     * @param size The number of bytes read per block.
+     */
+    void setBlockSize(size_t size) { blockSize = size > 0 ? size : DefaultBlockSize; }
+
+    /**
+     * @brief Opens a binary file for reading.
+     *
+     * @param file The path to the binary file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(std::string_view file) override
+    {
+        close();
+        inFile.open(file.data(), std::ios::binary | std::ios::in);
+        if (!inFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+    }
+
+    /**
+     * @brief Closes the currently open binary file.
+     *
+     * The buffer keeps its capacity so it can be reused for the next file.
+     */
+    void close() noexcept override
+    {
+        if (inFile.is_open())
+        {
+            inFile.close();
+        }
+        begin = 0;
+        end = 0;
+    }
+
+    /**
+     * @brief Reads the next record from the buffered blocks.
+     *
+     * Reads the size of the data (4 bytes, little-endian) and returns a view of the
+     * following data content. An empty view is returned at the end of the file.
+     *
+     * @return A view of the record bytes inside the buffer.
+     * @throws std::runtime_error If the file is not open, reading fails or the record is truncated.
+     */
+    std::span<const uint8_t> read() override
+    {
+        if (!inFile.is_open())
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        if (!fill(sizeof(uint32_t)))
+        {
+            return {};
+        }
+
+        // Read size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = 0;
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            dataSize |= static_cast<uint32_t>(buffer[begin + i]) << (i * 8);
+        }
+
+        if (!fill(sizeof(dataSize) + dataSize))
+        {
+            throw std::runtime_error("Failed to read data content");
+        }
+
+        std::span<const uint8_t> record(buffer.data() + begin + sizeof(dataSize), dataSize);
+        begin += sizeof(dataSize) + dataSize;
+        return record;
+    }
+
+private:
+    /**
+     * @brief Ensures that at least `count` unparsed bytes are in the buffer.
+     *
+     * Moves the unparsed tail to the front of the buffer and appends whole blocks
+     * from the stream until enough bytes are available or the file ends.
+     *
+     * @param count The number of bytes required.
+     * @return True if the bytes are available, false if the file ended first.
+     * @throws std::runtime_error If reading from the stream fails.
+     */
+    bool fill(size_t count)
+    {
+        if (end - begin >= count)
+        {
+            return true;
+        }
+
+        // Keep the partial record, it continues in the next block
+        size_t remaining = end - begin;
+        if (begin > 0 && remaining > 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + begin, remaining);
+        }
+        begin = 0;
+        end = remaining;
+
+        while (end < count)
+        {
+            if (inFile.eof())
+            {
+                return false;
+            }
+
+            size_t required = std::max(count, end + blockSize);
+            if (buffer.size() < required)
+            {
+                buffer.resize(required);
+            }
+
+            inFile.read(reinterpret_cast<char *>(buffer.data() + end), static_cast<std::streamsize>(buffer.size() - end));
+            if (inFile.bad() || (inFile.fail() && !inFile.eof()))
+            {
+                throw std::runtime_error("Failed to read data block");
+            }
+            end += static_cast<size_t>(inFile.gcount());
+        }
+        return true;
+    }
+};
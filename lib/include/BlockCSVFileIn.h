@@ -0,0 +1,252 @@
+#pragma once
+
+#include "FileIn.h"
+#include <fstream>
+#include <vector>
+#include <string_view>
+#include <optional>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <format>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief A class for reading lines from a CSV file in large blocks.
+ *
+ * This class extends `FileIn<std::string_view>` and reads the same files as `CSVFileIn`.
+ * The file is read in large blocks into a reusable buffer, line boundaries are found
+ * with vectorized scanning (AVX2 or SSE2 when the target supports it, scalar otherwise)
+ * and every line is returned as a view into the buffer without allocating.
+ *
+ * Blank lines are skipped, so that they do not end reading early. The end of the file is
+ * signalled by `tryRead()` returning no value instead of an exception. A returned view stays
+ * valid until the next call to `read()` or `tryRead()`.
+ */
+class BlockCSVFileIn : public FileIn<std::string_view>
+{
+public:
+    static constexpr size_t DefaultBlockSize = 1024 * 1024; ///< Default number of bytes read per block.
+
+private:
+    std::vector<char> buffer; ///< Reusable buffer holding the current block.
+    size_t blockSize;         ///< Number of bytes requested from the stream per read.
+    size_t begin = 0;         ///< Offset of the first unread byte in the buffer.
+    size_t end = 0;           ///< Offset one past the last valid byte in the buffer.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of bytes read per block.
+     */
+    explicit BlockCSVFileIn(size_t size = DefaultBlockSize) : blockSize(size > 0 ? size : DefaultBlockSize) {}
+
+    /**
+     * @brief Destructor that ensures the file is closed upon object destruction.
+     */
+    ~BlockCSVFileIn() { close(); }
+
+    /**
+     * @brief Sets the block size used for subsequent reads.
+     *
+     * @param size The number of bytes read per block.
+     */
+    void setBlockSize(size_t size) { blockSize = size > 0 ? size : DefaultBlockSize; }
+
+    /**
+     * @brief Opens a CSV file for reading.
+     *
+     * If a file is already open, it will be closed before opening a new one.
+     *
+     * @param file The path to the CSV file.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+        inFile.open(file.data(), std::ios::binary | std::ios::in);
+        if (!inFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+    }
+
+    /**
+     * @brief Closes the currently opened CSV file.
+     *
+     * The buffer keeps its capacity so it can be reused for the next file.
+     */
+    void close() noexcept override
+    {
+        if (inFile.is_open())
+        {
+            inFile.close();
+        }
+        begin = 0;
+        end = 0;
+    }
+
+    /**
+     * @brief Reads a single line from the CSV file.
+     *
+     * An empty view is returned at the end of the file.
+     *
+     * @return A view of the next line without its line terminator.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    std::string_view read() override
+    {
+        return tryRead().value_or(std::string_view{});
+    }
+
+    /**
+     * @brief Reads a single line from the CSV file, signalling the end of the file without exceptions.
+     *
+     * Both `\n` and `\r\n` line terminators are accepted. A last line without a terminator
+     * is returned as well. Lines holding only whitespace are skipped.
+     *
+     * @return A view of the next non-blank line, or no value at the end of the file.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    std::optional<std::string_view> tryRead() override
+    {
+        if (!inFile.is_open())
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        size_t scanned = begin;
+        while (true)
+        {
+            const char *newline = findNewline(buffer.data() + scanned, buffer.data() + end);
+            if (newline != buffer.data() + end)
+            {
+                size_t lineEnd = static_cast<size_t>(newline - buffer.data());
+                std::string_view line(buffer.data() + begin, lineEnd - begin);
+                begin = lineEnd + 1;
+                if (isBlank(line))
+                {
+                    scanned = begin;
+                    continue;
+                }
+                return trimCarriageReturn(line);
+            }
+
+            if (inFile.eof())
+            {
+                std::string_view line(buffer.data() + begin, end - begin);
+                begin = end;
+                if (isBlank(line))
+                {
+                    return std::nullopt;
+                }
+                return trimCarriageReturn(line);
+            }
+
+            // The line continues in the next block, only scan the new bytes
+            scanned = end - begin;
+            readBlock();
+            scanned += begin;
+        }
+    }
+
+private:
+    /**
+     * @brief Moves the unread tail to the front of the buffer and appends the next block.
+     *
+     * @throws std::runtime_error If reading from the stream fails.
+     */
+    void readBlock()
+    {
+        size_t remaining = end - begin;
+        if (begin > 0 && remaining > 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + begin, remaining);
+        }
+        begin = 0;
+        end = remaining;
+
+        if (buffer.size() < end + blockSize)
+        {
+            buffer.resize(end + blockSize);
+        }
+
+        inFile.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+        if (inFile.bad() || (inFile.fail() && !inFile.eof()))
+        {
+            throw std::runtime_error("Error reading file");
+        }
+        end += static_cast<size_t>(inFile.gcount());
+    }
+
+    /**
+     * @brief Checks whether a line holds only whitespace (including a `\r` terminator).
+     */
+    static bool isBlank(std::string_view line) noexcept
+    {
+        return line.find_first_not_of(" \t\r") == std::string_view::npos;
+    }
+
+    /**
+     * @brief Removes a trailing carriage return left over from a `\r\n` terminator.
+     */
+    static std::string_view trimCarriageReturn(std::string_view line) noexcept
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    /**
+     * @brief Finds the first newline character in a byte range.
+     *
+     * Compares 32 (AVX2) or 16 (SSE2) bytes at a time and finishes the tail with a scalar loop.
+     *
+     * @param first The start of the range.
+     * @param last The end of the range.
+     * @return A pointer to the newline, or `last` if there is none.
+     */
+    static const char *findNewline(const char *first, const char *last) noexcept
+    {
+#if defined(__AVX2__)
+        const __m256i newlines = _mm256_set1_epi8('\n');
+        for (; last - first >= 32; first += 32)
+        {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newlines)));
+            if (mask != 0)
+            {
+                return first + std::countr_zero(mask);
+            }
+        }
+#endif
+#if defined(__SSE2__)
+        const __m128i newlines16 = _mm_set1_epi8('\n');
+        for (; last - first >= 16; first += 16)
+        {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newlines16)));
+            if (mask != 0)
+            {
+                return first + std::countr_zero(mask);
+            }
+        }
+#endif
+        for (; first != last; ++first)
+        {
+            if (*first == '\n')
+            {
+                return first;
+            }
+        }
+        return last;
+    }
+};
@@ -0,0 +1,264 @@
+#pragma once
+
+#include "Crc32c.h"
+#include "LittleEndian.h"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <format>
+
+/**
+ * @brief Sidecar CRC-32C checksums of fixed-size blocks of a file.
+ *
+ * The file is split into blocks of `blockSize` bytes (the last one may be shorter) and
+ * the checksum of every block is stored next to it, e.g. `data.bin.crc` for `data.bin`.
+ * The writer feeds all bytes through `update()`, readers feed the bytes they read through
+ * `check()`, which verifies every block once it has been read completely.
+ *
+ * Format (little-endian): [4 bytes magic | 4 bytes block size | 8 bytes data size |
+ * 8 bytes data modification time | 4 bytes CRC per block]
+ *
+ * Checksums whose modification time differs from the file's are ignored, since the file was
+ * rewritten afterwards by a writer that does not maintain them.
+ */
+class BlockChecksums
+{
+public:
+    static constexpr uint32_t Magic = 0x32524342;           ///< Marks a checksum file ("BCR2").
+    static constexpr uint32_t PreviousMagic = 0x43524342;   ///< Marks a checksum file without modification time ("BCRC").
+    static constexpr size_t HeaderSize = 24;                ///< Size of the fixed part of a checksum file.
+    static constexpr uint32_t DefaultBlockSize = 64 * 1024; ///< Recommended block size.
+
+private:
+    std::vector<uint32_t> crcs; ///< Checksums of the complete blocks.
+    uint64_t dataSize = 0;      ///< Number of bytes covered by the checksums.
+    uint64_t verifyOffset = 0;  ///< Offset of the next byte `check()` expects.
+    uint32_t blockSize = 0;     ///< Number of bytes per block (0 = no checksums).
+    uint32_t current = 0;       ///< Checksum of the bytes of the current block so far.
+    bool tracking = true;       ///< Flag indicating whether `current` covers the current block from its start.
+
+public:
+    BlockChecksums() = default;
+
+    /**
+     * @brief Constructs empty checksums for a file being written.
+     *
+     * @param size The number of bytes per block.
+     */
+    explicit BlockChecksums(uint32_t size) : blockSize(size) {}
+
+    /**
+     * @brief Gets the path of the checksum file belonging to a file.
+     *
+     * @param file The path of the file.
+     * @return The path of the sidecar checksum file.
+     */
+    static std::string pathFor(std::string_view file) { return std::string(file) + ".crc"; }
+
+    /**
+     * @brief Checks whether checksums are computed or were loaded.
+     */
+    bool enabled() const { return blockSize > 0; }
+
+    /**
+     * @brief Gets the number of bytes per block.
+     */
+    uint32_t getBlockSize() const { return blockSize; }
+
+    /**
+     * @brief Gets the number of bytes covered by the checksums.
+     */
+    uint64_t getDataSize() const { return dataSize; }
+
+    /**
+     * @brief Adds written bytes to the checksums.
+     *
+     * @param data The bytes appended to the file.
+     * @param size The number of bytes.
+     */
+    void update(const uint8_t *data, size_t size)
+    {
+        while (size > 0)
+        {
+            size_t fill = static_cast<size_t>(dataSize % blockSize);
+            size_t count = std::min<size_t>(size, blockSize - fill);
+            current = Crc32c::compute(data, count, current);
+            data += count;
+            size -= count;
+            dataSize += count;
+
+            if (dataSize % blockSize == 0)
+            {
+                crcs.push_back(current);
+                current = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Verifies bytes read from the file.
+     *
+     * Bytes are expected in file order. After a jump (e.g. a seek), verification resumes
+     * with the next block boundary.
+     *
+     * @param offset The file offset of the first byte.
+     * @param data The bytes read.
+     * @param size The number of bytes.
+     * @throws std::runtime_error If a completed block does not match its checksum.
+     */
+    void check(uint64_t offset, const uint8_t *data, size_t size)
+    {
+        if (offset != verifyOffset)
+        {
+            tracking = offset % blockSize == 0;
+            current = 0;
+            verifyOffset = offset;
+        }
+
+        while (size > 0)
+        {
+            if (verifyOffset >= dataSize)
+            {
+                throw std::runtime_error("Data beyond checksummed size");
+            }
+
+            uint64_t block = verifyOffset / blockSize;
+            uint64_t blockEnd = std::min<uint64_t>((block + 1) * blockSize, dataSize);
+            size_t count = static_cast<size_t>(std::min<uint64_t>(size, blockEnd - verifyOffset));
+            if (tracking)
+            {
+                current = Crc32c::compute(data, count, current);
+            }
+            data += count;
+            size -= count;
+            verifyOffset += count;
+
+            if (verifyOffset == blockEnd)
+            {
+                if (tracking && current != crcs[block])
+                {
+                    throw std::runtime_error(std::format("Checksum mismatch in block {}", block));
+                }
+                tracking = true;
+                current = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Verifies a whole block.
+     *
+     * @param block The index of the block.
+     * @param data The bytes of the block.
+     * @param size The number of bytes of the block.
+     * @throws std::runtime_error If the block does not match its checksum.
+     */
+    void verifyBlock(uint64_t block, const uint8_t *data, size_t size) const
+    {
+        if (block >= crcs.size() || Crc32c::compute(data, size) != crcs[block])
+        {
+            throw std::runtime_error(std::format("Checksum mismatch in block {}", block));
+        }
+    }
+
+    /**
+     * @brief Writes the checksums to a file.
+     *
+     * The checksum of an incomplete last block is included.
+     *
+     * @param file The path of the checksum file.
+     * @param modified The modification time of the completed file, see `RecordIndex::modificationTime()`.
+     * @return True if the checksums were written.
+     */
+    bool save(const std::string &file, int64_t modified) const
+    {
+        std::ofstream out(file, std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+
+        std::vector<uint32_t> all = crcs;
+        if (dataSize % blockSize != 0)
+        {
+            all.push_back(current);
+        }
+
+        std::vector<uint8_t> buffer(HeaderSize + all.size() * sizeof(uint32_t));
+        LittleEndian::store(buffer.data(), Magic);
+        LittleEndian::store(buffer.data() + 4, blockSize);
+        LittleEndian::store(buffer.data() + 8, dataSize);
+        LittleEndian::store(buffer.data() + 16, modified);
+        for (size_t i = 0; i < all.size(); ++i)
+        {
+            LittleEndian::store(buffer.data() + HeaderSize + i * sizeof(uint32_t), all[i]);
+        }
+        out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return static_cast<bool>(out);
+    }
+
+    /**
+     * @brief Reads the checksums of a file.
+     *
+     * @param file The path of the checksum file.
+     * @param expectedModified The current modification time of the file, see `RecordIndex::modificationTime()`.
+     * @return False if the checksum file does not exist or belongs to an older version of the file.
+     * @throws std::runtime_error If the checksum file is corrupted.
+     */
+    bool load(const std::string &file, int64_t expectedModified)
+    {
+        *this = BlockChecksums();
+
+        std::ifstream in(file, std::ios::binary | std::ios::in);
+        if (!in)
+        {
+            return false;
+        }
+
+        uint8_t header[HeaderSize] = {};
+        in.read(reinterpret_cast<char *>(header), sizeof(header));
+
+        BlockChecksums checksums;
+        uint32_t magic = LittleEndian::load<uint32_t>(header);
+        if (magic == PreviousMagic)
+        {
+            // Cannot be matched against the file, treated like a missing checksum file
+            return false;
+        }
+        checksums.blockSize = LittleEndian::load<uint32_t>(header + 4);
+        checksums.dataSize = LittleEndian::load<uint64_t>(header + 8);
+        int64_t modified = LittleEndian::load<int64_t>(header + 16);
+        if (!in || magic != Magic || checksums.blockSize == 0)
+        {
+            throw std::runtime_error(std::format("Invalid checksum file: {}", file));
+        }
+        if (modified != expectedModified)
+        {
+            return false;
+        }
+
+        uint64_t blocks = (checksums.dataSize + checksums.blockSize - 1) / checksums.blockSize;
+        std::error_code error;
+        uint64_t fileSize = std::filesystem::file_size(file, error);
+        if (error || fileSize != sizeof(header) + blocks * sizeof(uint32_t))
+        {
+            throw std::runtime_error(std::format("Invalid checksum file: {}", file));
+        }
+
+        checksums.crcs.resize(blocks);
+        in.read(reinterpret_cast<char *>(checksums.crcs.data()), static_cast<std::streamsize>(blocks * sizeof(uint32_t)));
+        if (!in)
+        {
+            throw std::runtime_error(std::format("Invalid checksum file: {}", file));
+        }
+        LittleEndian::convert(checksums.crcs.data(), checksums.crcs.size());
+
+        *this = std::move(checksums);
+        return true;
+    }
+};
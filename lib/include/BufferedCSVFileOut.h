@@ -0,0 +1,286 @@
+#pragma once
+
+#include "FileOut.h"
+#include <fstream>
+#include <string>
+#include <span>
+#include <chrono>
+#include <format>
+#include <iostream>
+
+/**
+ * @brief Policy deciding when buffered output is flushed to the operating system.
+ */
+enum class FlushPolicy
+{
+    NEVER,         ///< Flush only when the buffer is full, on `flush()` or on `close()`.
+    EVERY_RECORDS, ///< Flush after every N records.
+    INTERVAL       ///< Flush on the first write after T milliseconds have elapsed.
+};
+
+/**
+ * @brief A class for buffered CSV file output.
+ *
+ * This class extends `FileOut<std::string>` and writes the same format as `CSVFileOut`.
+ * Lines are collected in a large buffer and written out once it reaches its size
+ * threshold or when the file is closed, without flushing the stream per record.
+ * A `FlushPolicy` additionally forces the data out every N records or every T milliseconds.
+ * A failed write of the buffer is reported by `write()`, `writeBatch()` and `flush()`, and
+ * as a warning by `close()`.
+ */
+class BufferedCSVFileOut : public FileOut<std::string>
+{
+public:
+    static constexpr size_t DefaultBufferSize = 1024 * 1024; ///< Default buffer size in bytes.
+
+private:
+    std::string buffer;                              ///< Buffer collecting the written lines.
+    size_t bufferSize;                               ///< Number of bytes collected before the buffer is written out.
+    FlushPolicy policy = FlushPolicy::NEVER;         ///< Active flush policy.
+    size_t flushRecords = 0;                         ///< Number of records between flushes (EVERY_RECORDS).
+    std::chrono::milliseconds flushInterval{0};      ///< Time between flushes (INTERVAL).
+    size_t pendingRecords = 0;                       ///< Records written since the last flush.
+    std::chrono::steady_clock::time_point lastFlush; ///< Time of the last flush.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The buffer size in bytes.
+     */
+    explicit BufferedCSVFileOut(size_t size = DefaultBufferSize) { setBufferSize(size); }
+
+    /**
+     * @brief Destructor that ensures buffered lines are written out.
+     */
+    ~BufferedCSVFileOut() { close(); }
+
+    /**
+     * @brief Sets the buffer size.
+     *
+     * @param size The buffer size in bytes.
+     */
+    void setBufferSize(size_t size)
+    {
+        bufferSize = size;
+        buffer.reserve(size);
+    }
+
+    /**
+     * @brief Disables periodic flushing, data is written out only when the buffer is full or on close.
+     */
+    void setFlushNever()
+    {
+        policy = FlushPolicy::NEVER;
+    }
+
+    /**
+     * @brief Flushes the file after every `records` written records.
+     *
+     * @param records The number of records between flushes.
+     * @throws std::invalid_argument If `records` is zero.
+     */
+    void setFlushEveryRecords(size_t records)
+    {
+        if (records == 0)
+        {
+            throw std::invalid_argument("Number of records between flushes must be positive");
+        }
+        policy = FlushPolicy::EVERY_RECORDS;
+        flushRecords = records;
+    }
+
+    /**
+     * @brief Flushes the file on the first write after `interval` has elapsed since the last flush.
+     *
+     * @param interval The time between flushes.
+     */
+    void setFlushInterval(std::chrono::milliseconds interval)
+    {
+        policy = FlushPolicy::INTERVAL;
+        flushInterval = interval;
+        lastFlush = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Gets the active flush policy.
+     *
+     * @return The flush policy.
+     */
+    FlushPolicy getFlushPolicy() const { return policy; }
+
+    /**
+     * @brief Opens a CSV file for writing.
+     *
+     * If a file is already open, it will be closed before opening a new one.
+     *
+     * @param file The path to the CSV file.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+        outFile.open(file.data(), std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!outFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+        pendingRecords = 0;
+        lastFlush = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Writes out the buffered lines and closes the file.
+     *
+     * If no file is open, this function does nothing.
+     */
+    void close() noexcept override
+    {
+        if (outFile.is_open())
+        {
+            try
+            {
+                flush();
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Warning: " << e.what() << std::endl;
+            }
+            outFile.close();
+        }
+        buffer.clear();
+    }
+
+    /**
+     * @brief Adds a line of CSV data to the buffer.
+     *
+     * A newline character is appended after the data. The buffer is written out when it
+     * reaches its size threshold or when the flush policy requires it.
+     *
+     * @param data The CSV-formatted string to write.
+     * @throws std::runtime_error If no file is open for writing or writing the buffer fails.
+     */
+    void write(const std::string &data) override
+    {
+        checkStream();
+
+        buffer.append(data);
+        buffer.push_back('\n');
+        pendingRecords++;
+
+        applyFlushPolicy();
+    }
+
+    /**
+     * @brief Adds several lines of CSV data to the buffer.
+     *
+     * The lines are appended in one pass, and the flush policy and the size threshold are
+     * checked once for the whole batch.
+     *
+     * @param records The CSV-formatted strings to write.
+     * @throws std::runtime_error If no file is open for writing or writing the buffer fails.
+     */
+    void writeBatch(std::span<const std::string> records) override
+    {
+        checkStream();
+
+        for (const auto &data : records)
+        {
+            buffer.append(data);
+            buffer.push_back('\n');
+        }
+        pendingRecords += records.size();
+
+        applyFlushPolicy();
+    }
+
+    /**
+     * @brief Writes out the buffered lines and flushes the stream to the operating system.
+     *
+     * @throws std::runtime_error If writing the buffer fails.
+     */
+    void flush() override
+    {
+        pendingRecords = 0;
+        lastFlush = std::chrono::steady_clock::now();
+        if (outFile.is_open())
+        {
+            writeBuffer();
+            outFile.flush();
+            if (!outFile)
+            {
+                throw std::runtime_error("Failed to write data block");
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Checks that a file is open and no earlier write of the buffer failed.
+     *
+     * @throws std::runtime_error If no file is open or the stream failed.
+     */
+    void checkStream() const
+    {
+        if (!outFile.is_open())
+        {
+            throw std::runtime_error("No file opened for writing");
+        }
+        if (!outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+    }
+
+    /**
+     * @brief Flushes the stream if the flush policy requires it, otherwise writes the
+     * buffer out once it reaches its size threshold.
+     *
+     * @throws std::runtime_error If writing the buffer fails.
+     */
+    void applyFlushPolicy()
+    {
+        switch (policy)
+        {
+        case FlushPolicy::EVERY_RECORDS:
+            if (pendingRecords >= flushRecords)
+            {
+                flush();
+                return;
+            }
+            break;
+        case FlushPolicy::INTERVAL:
+            if (std::chrono::steady_clock::now() - lastFlush >= flushInterval)
+            {
+                flush();
+                return;
+            }
+            break;
+        case FlushPolicy::NEVER:
+            break;
+        }
+
+        if (buffer.size() >= bufferSize)
+        {
+            writeBuffer();
+        }
+    }
+
+    /**
+     * @brief Hands the buffer to the stream in a single call and empties it.
+     *
+     * @throws std::runtime_error If the stream fails to write the buffer.
+     */
+    void writeBuffer()
+    {
+        if (!buffer.empty())
+        {
+            outFile.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+            if (!outFile)
+            {
+                throw std::runtime_error("Failed to write data block");
+            }
+        }
+    }
+};
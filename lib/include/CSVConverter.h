@@ -3,6 +3,10 @@
 #include "Converter.h"
 #include <string>
 #include <vector>
+#include <string_view>
+#include <span>
+#include <stdexcept>
+#include <algorithm>
 
 /**
  * @brief Abstract class for converting data to and from CSV format.
@@ -43,4 +47,41 @@ public:
      * @return An object of type `T` parsed from the string.
      */
     virtual T convert(const std::string &data) override = 0; // Fixed type
+
+    using Converter<T, std::string>::encode;
+
+    /**
+     * @brief Encodes an object of type `T` into a caller-provided character buffer.
+     * 
+     * The default implementation copies the result of `convert()`.
+     * 
+     * @param data The object to convert.
+     * @param out The buffer receiving the CSV-formatted characters.
+     * @return The number of characters written.
+     * @throws std::length_error If the buffer is too small.
+     */
+    virtual size_t encode(const T &data, std::span<char> out)
+    {
+        OutputType text = this->convert(data);
+        if (text.size() > out.size())
+        {
+            throw std::length_error("Buffer too small for encoded data");
+        }
+        std::copy(text.begin(), text.end(), out.begin());
+        return text.size();
+    }
+
+    /**
+     * @brief Parses a CSV-formatted view back into an object of type `T`.
+     * 
+     * Lets readers parse fields without copying them into a string. The default
+     * implementation copies the characters and calls `convert()`.
+     * 
+     * @param data A view of the CSV-formatted characters.
+     * @return An object of type `T` parsed from the view.
+     */
+    virtual T decode(std::string_view data)
+    {
+        return this->convert(OutputType(data));
+    }
 };
\ No newline at end of file
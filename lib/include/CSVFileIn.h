@@ -3,6 +3,8 @@
 #include "FileIn.h"
 #include <fstream>
 #include <string>
+#include <optional>
+#include <utility>
 #include <format>
 
 /**
@@ -61,13 +63,29 @@ public:
      * @throws std::runtime_error If the end of the file is reached or if reading fails.
      */
     std::string read() override
+    {
+        auto line = tryRead();
+        if (!line)
+        {
+            throw std::runtime_error("End of file reached");
+        }
+        return std::move(*line);
+    }
+
+    /**
+     * @brief Reads a single line from the CSV file, signalling the end of the file without exceptions.
+     *
+     * @return The next line from the file, or no value at the end of the file.
+     * @throws std::runtime_error If reading fails.
+     */
+    std::optional<std::string> tryRead() override
     {
         std::string line;
         if (!std::getline(inFile, line))
         {
             if (inFile.eof())
             {
-                throw std::runtime_error("End of file reached");
+                return std::nullopt;
             }
             throw std::runtime_error("Error reading file");
         }
@@ -3,6 +3,7 @@
 #include "FileOut.h"
 #include <fstream>
 #include <string>
+#include <span>
 #include <format>
 
 /**
@@ -14,6 +15,9 @@
  */
 class CSVFileOut : public FileOut<std::string>
 {
+private:
+    std::string staging; ///< Lines of the batch being written by `writeBatch()`.
+
 public:
     /**
      * @brief Opens a CSV file for writing.
@@ -66,4 +70,30 @@ public:
         outFile.write(data.data(), data.size()); // Write data to file
         outFile << std::endl;                    // Append a newline character
     }
+
+    /**
+     * @brief Writes several lines of CSV data to the file.
+     * 
+     * The lines are joined in a staging buffer and written with a single call, then the
+     * stream is flushed once, as `write()` does for every line.
+     * 
+     * @param records The CSV-formatted strings to write.
+     * @throws std::runtime_error If no file is open for writing.
+     */
+    void writeBatch(std::span<const std::string> records) override
+    {
+        if (!outFile)
+        {
+            throw std::runtime_error("No file opened for writing");
+        }
+
+        staging.clear();
+        for (const auto &data : records)
+        {
+            staging.append(data);
+            staging.push_back('\n');
+        }
+        outFile.write(staging.data(), static_cast<std::streamsize>(staging.size()));
+        outFile.flush();
+    }
 };
\ No newline at end of file
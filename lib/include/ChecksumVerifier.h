@@ -0,0 +1,154 @@
+#pragma once
+
+#include "BlockChecksums.h"
+#include "RecordIndex.h"
+#include <vector>
+#include <string>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+/**
+ * @brief Describes a file that failed checksum verification.
+ */
+struct ChecksumFailure
+{
+    std::string path;    ///< Path of the file.
+    std::string message; ///< Reason of the failure.
+};
+
+/**
+ * @brief Verifies files against their sidecar `BlockChecksums`.
+ *
+ * `verify()` checks every file with a checksum file below a base path (e.g. the base
+ * path of an `OutputManager`), spreading the files over all available cores.
+ */
+class ChecksumVerifier
+{
+public:
+    /**
+     * @brief Verifies a single file against its checksum file.
+     *
+     * @param file The path of the file.
+     * @throws std::runtime_error If the checksum file is missing, out of date or invalid, the
+     *         size of the file does not match, or a block does not match its checksum.
+     */
+    static void verifyFile(const std::string &file)
+    {
+        BlockChecksums checksums;
+        std::string checksumPath = BlockChecksums::pathFor(file);
+        if (!checksums.load(checksumPath, RecordIndex::modificationTime(file)))
+        {
+            if (std::filesystem::exists(checksumPath))
+            {
+                throw std::runtime_error(std::format("Checksum file is out of date: {}", checksumPath));
+            }
+            throw std::runtime_error(std::format("Missing checksum file: {}", checksumPath));
+        }
+
+        std::error_code error;
+        uint64_t size = std::filesystem::file_size(file, error);
+        if (error || size != checksums.getDataSize())
+        {
+            throw std::runtime_error(std::format("File size does not match its checksums: {}", file));
+        }
+
+        std::ifstream in(file, std::ios::binary | std::ios::in);
+        if (!in)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        // Read several blocks at once to keep the number of calls low
+        size_t blockSize = checksums.getBlockSize();
+        size_t blocksPerRead = std::max<size_t>(1, (1024 * 1024) / blockSize);
+        std::vector<uint8_t> buffer(blockSize * blocksPerRead);
+        uint64_t block = 0;
+        while (size > 0)
+        {
+            size_t count = static_cast<size_t>(std::min<uint64_t>(size, buffer.size()));
+            in.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(count));
+            if (!in)
+            {
+                throw std::runtime_error(std::format("Failed to read file: {}", file));
+            }
+
+            for (size_t offset = 0; offset < count; offset += blockSize)
+            {
+                checksums.verifyBlock(block++, buffer.data() + offset, std::min(blockSize, count - offset));
+            }
+            size -= count;
+        }
+    }
+
+    /**
+     * @brief Verifies all files with checksum files below a base path.
+     *
+     * @param basePath The directory to search recursively.
+     * @param threads The number of worker threads, 0 uses all available cores.
+     * @return The files that failed verification, sorted by path.
+     * @throws std::runtime_error If the base path cannot be searched.
+     */
+    static std::vector<ChecksumFailure> verify(const std::string &basePath, unsigned threads = 0)
+    {
+        std::vector<std::string> files;
+        try
+        {
+            for (const auto &entry : std::filesystem::recursive_directory_iterator(basePath))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".crc")
+                {
+                    std::filesystem::path file = entry.path();
+                    files.push_back(file.replace_extension().string());
+                }
+            }
+        }
+        catch (const std::filesystem::filesystem_error &e)
+        {
+            throw std::runtime_error(std::format("Failed to search directory: {} ({})", basePath, e.what()));
+        }
+
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threads = static_cast<unsigned>(std::min<size_t>(threads, files.size()));
+
+        std::vector<ChecksumFailure> failures;
+        std::mutex failuresMutex;
+        std::atomic<size_t> next = 0;
+        auto worker = [&]()
+        {
+            for (size_t i = next++; i < files.size(); i = next++)
+            {
+                try
+                {
+                    verifyFile(files[i]);
+                }
+                catch (const std::exception &e)
+                {
+                    std::lock_guard<std::mutex> lock(failuresMutex);
+                    failures.push_back({files[i], e.what()});
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < threads; ++i)
+        {
+            workers.emplace_back(worker);
+        }
+        for (auto &thread : workers)
+        {
+            thread.join();
+        }
+
+        std::ranges::sort(failures, {}, &ChecksumFailure::path);
+        return failures;
+    }
+};
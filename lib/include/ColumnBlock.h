@@ -0,0 +1,74 @@
+#pragma once
+
+#include "LittleEndian.h"
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Zone map entry describing one block of a column file.
+ *
+ * Column files (`ColumnFileOut`, `ColumnFileIn`) consist of blocks of little-endian doubles
+ * followed by a footer with one entry per block and a trailer, all little-endian:
+ *
+ * [block 0 | block 1 | ... | footer: entries | 8 bytes footer offset | 4 bytes block count |
+ *  4 bytes block size | 4 bytes magic]
+ *
+ * Each footer entry holds [8 bytes offset | 4 bytes count | 4 bytes NaN count | 8 bytes min |
+ * 8 bytes max | 8 bytes sum]. NaN values are stored but ignored by min and max.
+ */
+struct ColumnBlock
+{
+    static constexpr uint32_t Magic = 0x4C4F435A; ///< Marks the end of a column file ("ZCOL").
+    static constexpr size_t EntrySize = 40;       ///< Size of a footer entry in bytes.
+    static constexpr size_t TrailerSize = 20;     ///< Size of the trailer in bytes.
+
+    uint64_t offset = 0;                                   ///< File offset of the block.
+    uint32_t count = 0;                                    ///< Number of values in the block.
+    uint32_t nanCount = 0;                                 ///< Number of NaN values in the block.
+    double min = std::numeric_limits<double>::infinity();  ///< Smallest value in the block.
+    double max = -std::numeric_limits<double>::infinity(); ///< Largest value in the block.
+    double sum = 0.0;                                      ///< Sum of the values in the block, excluding NaNs.
+
+    /**
+     * @brief Checks whether the block may contain values in the range [lower, upper].
+     */
+    bool overlaps(double lower, double upper) const { return min <= upper && max >= lower; }
+
+    /**
+     * @brief Checks whether all values of the block except NaNs lie in the range [lower, upper].
+     */
+    bool within(double lower, double upper) const { return min >= lower && max <= upper; }
+
+    /**
+     * @brief Writes the footer entry of the block.
+     *
+     * @param out Destination of `EntrySize` bytes.
+     */
+    void store(uint8_t *out) const
+    {
+        LittleEndian::store(out, offset);
+        LittleEndian::store(out + 8, count);
+        LittleEndian::store(out + 12, nanCount);
+        LittleEndian::store(out + 16, min);
+        LittleEndian::store(out + 24, max);
+        LittleEndian::store(out + 32, sum);
+    }
+
+    /**
+     * @brief Reads a footer entry.
+     *
+     * @param in Source of `EntrySize` bytes.
+     * @return The block described by the entry.
+     */
+    static ColumnBlock load(const uint8_t *in)
+    {
+        ColumnBlock block;
+        block.offset = LittleEndian::load<uint64_t>(in);
+        block.count = LittleEndian::load<uint32_t>(in + 8);
+        block.nanCount = LittleEndian::load<uint32_t>(in + 12);
+        block.min = LittleEndian::load<double>(in + 16);
+        block.max = LittleEndian::load<double>(in + 24);
+        block.sum = LittleEndian::load<double>(in + 32);
+        return block;
+    }
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "BinConverter.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief Converts a double value to and from its raw 8-byte representation.
+ *
+ * Used with `ColumnFileOut` and `ColumnFileIn`, which store the values of a stream
+ * in column blocks and need no per-record framing, and with `GorillaFileOut` and
+ * `GorillaFileIn`, which compress such blocks.
+ *
+ * Format: [8 bytes double]
+ */
+class ColumnConverter : public BinConverter<double>
+{
+public:
+    /**
+     * @brief Converts a double value to binary format.
+     * @param data The double to convert.
+     * @return A byte vector holding the raw value.
+     */
+    std::vector<uint8_t> convert(const double &data) override
+    {
+        std::vector<uint8_t> buffer(sizeof(double));
+        std::memcpy(buffer.data(), &data, sizeof(data));
+        return buffer;
+    }
+
+    /**
+     * @brief Encodes a double value into a reusable buffer.
+     * @param data The double to convert.
+     * @param out The buffer receiving the raw value, resized to 8 bytes.
+     */
+    void encode(const double &data, std::vector<uint8_t> &out) override
+    {
+        out.resize(sizeof(double));
+        std::memcpy(out.data(), &data, sizeof(data));
+    }
+
+    /**
+     * @brief Encodes a double value into a caller-provided buffer.
+     * @param data The double to convert.
+     * @param out The buffer receiving the raw value, at least 8 bytes.
+     * @return The number of bytes written.
+     * @throws std::length_error if the buffer is too small.
+     */
+    size_t encode(const double &data, std::span<uint8_t> out) override
+    {
+        if (out.size() < sizeof(double))
+        {
+            throw std::length_error("Buffer too small for encoded data");
+        }
+        std::memcpy(out.data(), &data, sizeof(data));
+        return sizeof(double);
+    }
+
+    /**
+     * @brief Converts binary data back to a double.
+     * @param data A byte vector holding the raw value.
+     * @return The extracted double value.
+     * @throws std::runtime_error if the size does not match a double.
+     */
+    double convert(const std::vector<uint8_t> &data) override
+    {
+        return convert(std::span<const uint8_t>(data));
+    }
+
+    /**
+     * @brief Converts a view of binary data back to a double.
+     * @param data A view of the raw value.
+     * @return The extracted double value.
+     * @throws std::runtime_error if the size does not match a double.
+     */
+    double convert(std::span<const uint8_t> data)
+    {
+        return decode(data);
+    }
+
+    /**
+     * @brief Decodes a view of binary data to a double.
+     * @param data A view of the raw value.
+     * @return The extracted double value.
+     * @throws std::runtime_error if the size does not match a double.
+     */
+    double decode(std::span<const uint8_t> data) override
+    {
+        if (data.size() != sizeof(double))
+        {
+            throw std::runtime_error("Invalid data size for column value");
+        }
+
+        double result;
+        std::memcpy(&result, data.data(), sizeof(result));
+        return result;
+    }
+};
@@ -0,0 +1,390 @@
+#pragma once
+
+#include "FileIn.h"
+#include "ColumnBlock.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <format>
+
+/**
+ * @brief Class for reading double values from a column file written by `ColumnFileOut`.
+ *
+ * The footer with the zone maps of all blocks is loaded on `open()`. A value range set
+ * with `setRange()` restricts `read()` to matching values; blocks whose minimum and
+ * maximum rule the range out are skipped without being read. Aggregates such as
+ * `count()`, `sum()` or `countInRange()` are answered from the footer and only read
+ * the blocks that straddle a range boundary.
+ *
+ * Each `read()` returns the raw 8-byte value for `ColumnConverter`.
+ */
+class ColumnFileIn : public FileIn<std::vector<uint8_t>>
+{
+private:
+    std::vector<ColumnBlock> blocks;                         ///< Zone maps of all blocks.
+    std::vector<double> values;                              ///< Values of the current block.
+    size_t nextBlock = 0;                                    ///< Index of the next block to read.
+    size_t position = 0;                                     ///< Index of the next value in `values`.
+    double lower = -std::numeric_limits<double>::infinity(); ///< Lower bound of the value range.
+    double upper = std::numeric_limits<double>::infinity();  ///< Upper bound of the value range.
+    bool filtered = false;                                   ///< Flag indicating whether a value range is set.
+
+public:
+    /**
+     * @brief Opens a column file and loads its footer.
+     *
+     * @param file The path to the column file to open.
+     * @throws std::runtime_error If the file cannot be opened or has no valid footer.
+     */
+    void open(std::string_view file) override
+    {
+        close();
+        inFile.open(std::string(file), std::ios::binary | std::ios::in);
+        if (!inFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        try
+        {
+            loadFooter();
+        }
+        catch (const std::exception &)
+        {
+            close();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Closes the currently open column file.
+     */
+    void close() noexcept override
+    {
+        if (inFile.is_open())
+        {
+            inFile.close();
+        }
+        blocks.clear();
+        values.clear();
+        nextBlock = 0;
+        position = 0;
+    }
+
+    /**
+     * @brief Restricts reading to values in the range [min, max].
+     *
+     * Blocks that cannot contain such values are skipped. Applies to the values not read yet.
+     *
+     * @param min The lower bound of the range.
+     * @param max The upper bound of the range.
+     */
+    void setRange(double min, double max)
+    {
+        lower = min;
+        upper = max;
+        filtered = true;
+    }
+
+    /**
+     * @brief Removes the value range, all values are read again.
+     */
+    void clearRange()
+    {
+        lower = -std::numeric_limits<double>::infinity();
+        upper = std::numeric_limits<double>::infinity();
+        filtered = false;
+    }
+
+    /**
+     * @brief Gets the zone maps of all blocks.
+     *
+     * @return A constant reference to the zone maps.
+     */
+    const std::vector<ColumnBlock> &getBlocks() const { return blocks; }
+
+    /**
+     * @brief Reads the next value (in the value range, if set).
+     *
+     * @return The raw 8-byte value, or an empty vector at the end of the file.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    std::vector<uint8_t> read() override
+    {
+        while (true)
+        {
+            while (position < values.size())
+            {
+                double value = values[position++];
+                if (!filtered || (value >= lower && value <= upper))
+                {
+                    std::vector<uint8_t> buffer(sizeof(double));
+                    std::memcpy(buffer.data(), &value, sizeof(value));
+                    return buffer;
+                }
+            }
+
+            if (!nextMatchingBlock())
+            {
+                return {};
+            }
+        }
+    }
+
+    /**
+     * @brief Appends the values of the next block (in the value range, if set) to a vector.
+     *
+     * Blocks that cannot contain values in the range are skipped.
+     *
+     * @param out The vector the values are appended to.
+     * @return False at the end of the file.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    bool readBlock(std::vector<double> &out)
+    {
+        if (position >= values.size() && !nextMatchingBlock())
+        {
+            return false;
+        }
+
+        std::span<const double> rest(values.data() + position, values.size() - position);
+        position = values.size();
+        if (!filtered)
+        {
+            out.insert(out.end(), rest.begin(), rest.end());
+            return true;
+        }
+        for (double value : rest)
+        {
+            if (value >= lower && value <= upper)
+            {
+                out.push_back(value);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of values in the file from the footer.
+     *
+     * @return The number of values, including NaNs.
+     */
+    uint64_t count() const
+    {
+        uint64_t result = 0;
+        for (const auto &block : blocks)
+        {
+            result += block.count;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the sum of the values in the file from the footer.
+     *
+     * @return The sum of all values except NaNs.
+     */
+    double sum() const
+    {
+        double result = 0.0;
+        for (const auto &block : blocks)
+        {
+            result += block.sum;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the smallest value in the file from the footer.
+     *
+     * @return The smallest value, or infinity if the file holds no numbers.
+     */
+    double min() const
+    {
+        double result = std::numeric_limits<double>::infinity();
+        for (const auto &block : blocks)
+        {
+            result = std::min(result, block.min);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the largest value in the file from the footer.
+     *
+     * @return The largest value, or negative infinity if the file holds no numbers.
+     */
+    double max() const
+    {
+        double result = -std::numeric_limits<double>::infinity();
+        for (const auto &block : blocks)
+        {
+            result = std::max(result, block.max);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Gets the mean of the values in the file from the footer.
+     *
+     * @return The mean of all values except NaNs, or 0.0 if the file holds no numbers.
+     */
+    double mean() const
+    {
+        uint64_t numbers = 0;
+        for (const auto &block : blocks)
+        {
+            numbers += block.count - block.nanCount;
+        }
+        return numbers > 0 ? sum() / static_cast<double>(numbers) : 0.0;
+    }
+
+    /**
+     * @brief Counts the values in the range [min, max].
+     *
+     * Blocks entirely inside or outside the range are counted from the footer, only
+     * blocks straddling a range boundary are read. The read position is not affected.
+     *
+     * @param min The lower bound of the range.
+     * @param max The upper bound of the range.
+     * @return The number of values in the range.
+     * @throws std::runtime_error If reading a block fails.
+     */
+    uint64_t countInRange(double min, double max)
+    {
+        uint64_t result = 0;
+        std::vector<double> buffer;
+        for (const auto &block : blocks)
+        {
+            if (!block.overlaps(min, max))
+            {
+                continue;
+            }
+            if (block.within(min, max))
+            {
+                result += block.count - block.nanCount;
+                continue;
+            }
+
+            loadBlock(block, buffer);
+            for (double value : buffer)
+            {
+                result += value >= min && value <= max ? 1 : 0;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Counts the values greater than a threshold.
+     *
+     * @param threshold The exclusive lower bound.
+     * @return The number of values greater than `threshold`.
+     * @throws std::runtime_error If reading a block fails.
+     */
+    uint64_t countGreaterThan(double threshold)
+    {
+        return countInRange(std::nextafter(threshold, std::numeric_limits<double>::infinity()),
+                            std::numeric_limits<double>::infinity());
+    }
+
+private:
+    /**
+     * @brief Loads the next block that may contain values in the range.
+     *
+     * @return False if no such block is left.
+     */
+    bool nextMatchingBlock()
+    {
+        if (!inFile.is_open())
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        while (nextBlock < blocks.size())
+        {
+            const ColumnBlock &block = blocks[nextBlock++];
+            if (!filtered || block.overlaps(lower, upper))
+            {
+                loadBlock(block, values);
+                position = 0;
+                return true;
+            }
+        }
+        values.clear();
+        position = 0;
+        return false;
+    }
+
+    /**
+     * @brief Reads the values of a block.
+     *
+     * @param block The zone map of the block.
+     * @param out The vector receiving the values.
+     * @throws std::runtime_error If reading fails.
+     */
+    void loadBlock(const ColumnBlock &block, std::vector<double> &out)
+    {
+        out.resize(block.count);
+        inFile.clear();
+        inFile.seekg(static_cast<std::streamoff>(block.offset));
+        inFile.read(reinterpret_cast<char *>(out.data()), static_cast<std::streamsize>(block.count * sizeof(double)));
+        if (!inFile)
+        {
+            throw std::runtime_error("Failed to read data content");
+        }
+        LittleEndian::convert(out.data(), out.size());
+    }
+
+    /**
+     * @brief Reads and validates the trailer and the zone maps of all blocks.
+     *
+     * @throws std::runtime_error If the footer is missing or corrupted.
+     */
+    void loadFooter()
+    {
+        inFile.seekg(0, std::ios::end);
+        uint64_t fileSize = static_cast<uint64_t>(inFile.tellg());
+        if (fileSize < ColumnBlock::TrailerSize)
+        {
+            throw std::runtime_error("Missing column footer");
+        }
+
+        uint8_t trailer[ColumnBlock::TrailerSize];
+        inFile.seekg(static_cast<std::streamoff>(fileSize - ColumnBlock::TrailerSize));
+        inFile.read(reinterpret_cast<char *>(trailer), sizeof(trailer));
+
+        uint64_t footerOffset = LittleEndian::load<uint64_t>(trailer);
+        uint32_t blockCount = LittleEndian::load<uint32_t>(trailer + 8);
+        uint32_t magic = LittleEndian::load<uint32_t>(trailer + 16);
+        if (!inFile || magic != ColumnBlock::Magic ||
+            footerOffset + uint64_t{blockCount} * ColumnBlock::EntrySize + ColumnBlock::TrailerSize != fileSize)
+        {
+            throw std::runtime_error("Missing column footer");
+        }
+
+        std::vector<uint8_t> footer(blockCount * ColumnBlock::EntrySize);
+        inFile.seekg(static_cast<std::streamoff>(footerOffset));
+        inFile.read(reinterpret_cast<char *>(footer.data()), static_cast<std::streamsize>(footer.size()));
+        if (!inFile)
+        {
+            throw std::runtime_error("Failed to read column footer");
+        }
+
+        blocks.reserve(blockCount);
+        for (uint32_t i = 0; i < blockCount; ++i)
+        {
+            ColumnBlock block = ColumnBlock::load(footer.data() + i * ColumnBlock::EntrySize);
+            if (block.offset + uint64_t{block.count} * sizeof(double) > footerOffset)
+            {
+                throw std::runtime_error("Corrupted column footer");
+            }
+            blocks.push_back(block);
+        }
+    }
+};
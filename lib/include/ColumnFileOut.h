@@ -0,0 +1,214 @@
+#pragma once
+
+#include "FileOut.h"
+#include "ColumnBlock.h"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include <format>
+
+/**
+ * @brief Class for writing double values to a column file with per-block zone maps.
+ *
+ * This class inherits from `FileOut` and receives the raw 8-byte values produced by
+ * `ColumnConverter`. Values are stored without framing in blocks of a fixed number of
+ * values. When the file is closed, a footer with the offset, count, minimum, maximum
+ * and sum of every block is appended (see `ColumnBlock` for the layout).
+ *
+ * `flush()` writes out the current, possibly partial, block. The file is only readable
+ * by `ColumnFileIn` once it has been closed.
+ */
+class ColumnFileOut : public FileOut<std::vector<uint8_t>>
+{
+public:
+    static constexpr size_t DefaultBlockSize = 8192; ///< Default number of values per block.
+
+private:
+    std::vector<ColumnBlock> blocks; ///< Zone maps of the blocks written so far.
+    std::vector<double> values;      ///< Values of the block being collected.
+    uint64_t fileOffset = 0;         ///< File offset of the next block.
+    size_t blockSize;                ///< Number of values per block.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of values per block.
+     */
+    explicit ColumnFileOut(size_t size = DefaultBlockSize) : blockSize(size > 0 ? size : DefaultBlockSize) {}
+
+    /**
+     * @brief Destructor that writes out the footer and closes the file.
+     */
+    ~ColumnFileOut() { close(); }
+
+    /**
+     * @brief Sets the number of values per block.
+     *
+     * Takes effect with the next block.
+     *
+     * @param size The number of values per block, 0 restores the default.
+     */
+    void setBlockSize(size_t size) { blockSize = size > 0 ? size : DefaultBlockSize; }
+
+    /**
+     * @brief Gets the number of values per block.
+     *
+     * @return The number of values per block.
+     */
+    size_t getBlockSize() const { return blockSize; }
+
+    /**
+     * @brief Opens (and truncates) a column file for writing.
+     *
+     * @param file The path to the column file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+        outFile.open(std::string(file), std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!outFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        blocks.clear();
+        values.clear();
+        values.reserve(blockSize);
+        fileOffset = 0;
+    }
+
+    /**
+     * @brief Writes out the current block and the footer and closes the file.
+     */
+    void close() noexcept override
+    {
+        if (!outFile.is_open())
+        {
+            return;
+        }
+
+        try
+        {
+            writeBlock();
+            writeFooter();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: Failed to write column footer: " << e.what() << std::endl;
+        }
+        outFile.close();
+    }
+
+    /**
+     * @brief Adds a value to the current block.
+     *
+     * @param data The raw 8-byte value produced by `ColumnConverter`.
+     * @throws std::runtime_error If the file is not open, the value has an invalid size or writing fails.
+     */
+    void write(const std::vector<uint8_t> &data) override
+    {
+        if (!outFile.is_open())
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+        if (data.size() != sizeof(double))
+        {
+            throw std::runtime_error("Invalid data size for column value");
+        }
+
+        double value;
+        std::memcpy(&value, data.data(), sizeof(value));
+        values.push_back(value);
+        if (values.size() >= blockSize)
+        {
+            writeBlock();
+        }
+    }
+
+    /**
+     * @brief Writes out the current block and flushes the stream.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void flush() override
+    {
+        if (outFile.is_open())
+        {
+            writeBlock();
+            outFile.flush();
+        }
+    }
+
+private:
+    /**
+     * @brief Writes the collected values as one block and records its zone map.
+     */
+    void writeBlock()
+    {
+        if (values.empty())
+        {
+            return;
+        }
+
+        ColumnBlock block;
+        block.offset = fileOffset;
+        block.count = static_cast<uint32_t>(values.size());
+        for (double value : values)
+        {
+            if (std::isnan(value))
+            {
+                ++block.nanCount;
+                continue;
+            }
+            block.min = std::min(block.min, value);
+            block.max = std::max(block.max, value);
+            block.sum += value;
+        }
+
+        size_t size = values.size() * sizeof(double);
+        LittleEndian::convert(values.data(), values.size());
+        outFile.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(size));
+        // The converted values must not be written again
+        values.clear();
+        if (!outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+
+        fileOffset += size;
+        blocks.push_back(block);
+    }
+
+    /**
+     * @brief Writes the zone maps of all blocks and the trailer.
+     */
+    void writeFooter()
+    {
+        std::vector<uint8_t> footer(blocks.size() * ColumnBlock::EntrySize + ColumnBlock::TrailerSize);
+        uint8_t *out = footer.data();
+        for (const auto &block : blocks)
+        {
+            block.store(out);
+            out += ColumnBlock::EntrySize;
+        }
+
+        uint32_t blockCount = static_cast<uint32_t>(blocks.size());
+        uint32_t size = static_cast<uint32_t>(blockSize);
+        LittleEndian::store(out, fileOffset);
+        LittleEndian::store(out + 8, blockCount);
+        LittleEndian::store(out + 12, size);
+        LittleEndian::store(out + 16, ColumnBlock::Magic);
+
+        outFile.write(reinterpret_cast<const char *>(footer.data()), static_cast<std::streamsize>(footer.size()));
+        if (!outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+    }
+};
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "OutputManager.h"
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <concepts>
+
+/**
+ * @brief Hands out independent replications to threads running simulations in parallel.
+ *
+ * Every worker thread obtains its own `Handle`, an output manager of type `M` with its own
+ * directory and writers, so the records are written without any locking. Replication
+ * numbers are taken from an atomic counter, and the only shared state, the manifest of the
+ * base path (if enabled), is appended to under a mutex when a replication is finished. The manifest is
+ * checked for the remains of an interrupted append once per manager, not by every handle.
+ *
+ * @code
+ * ConcurrentOutputManager<CasinoBinOutputManager> manager(path);
+ * manager.setName("Replication");
+ * // in every worker thread:
+ * auto handle = manager.newReplication();
+ * handle->writeResults(simulateCasino());
+ * manager.newReplication(*handle); // next replication on the same handle
+ * @endcode
+ *
+ * `M` must keep every replication in storage of its own, as `OutputManager` does with one
+ * directory per replication; managers appending to shared files (e.g. `ArchiveOutputManager`)
+ * cannot be used.
+ *
+ * @tparam M The output manager type, derived from `OutputManager` and constructible from the base path.
+ */
+template <typename M>
+    requires std::derived_from<M, OutputManager> && std::constructible_from<M, const std::string &>
+class ConcurrentOutputManager
+{
+public:
+    /**
+     * @brief Output manager of one worker thread.
+     *
+     * Must be used by one thread at a time and destroyed before the `ConcurrentOutputManager`.
+     */
+    class Handle : public M
+    {
+    private:
+        ConcurrentOutputManager *owner; ///< Manager the handle was obtained from.
+
+    public:
+        /**
+         * @brief Constructs a handle writing to the base path of a manager.
+         *
+         * @param manager The manager the handle belongs to.
+         */
+        explicit Handle(ConcurrentOutputManager &manager) : M(manager.basePath), owner(&manager)
+        {
+            this->setName(manager.name);
+            this->setManifestEnabled(manager.manifestEnabled);
+            this->setPooled(manager.pooled);
+            this->skipManifestResume();
+        }
+
+        /**
+         * @brief Destructor that finishes the current replication while the manifest override is active.
+         */
+        ~Handle() override { this->finishReplication(); }
+
+    protected:
+        /**
+         * @brief Appends an entry to the shared manifest under the lock of the manager.
+         *
+         * The first append of any handle drops the remains of an interrupted append.
+         */
+        void appendToManifest(const DatasetManifest::Entry &entry) override
+        {
+            std::lock_guard lock(owner->manifestMutex);
+            if (!owner->manifestResumed)
+            {
+                DatasetManifest::dropTornTail(DatasetManifest::pathFor(this->getBasePath()));
+                owner->manifestResumed = true;
+            }
+            M::appendToManifest(entry);
+        }
+    };
+
+private:
+    std::string basePath;         ///< Base path where the replications are stored.
+    std::string name;             ///< Name of the replications, followed by their number.
+    bool manifestEnabled = false; ///< Flag indicating whether the handles maintain the manifest.
+    bool pooled = false;          ///< Flag indicating whether the handles reuse their writers.
+    std::atomic<int> counter{1};  ///< Number of the next replication.
+    std::mutex manifestMutex;     ///< Serialises appends to the manifest.
+    bool manifestResumed = false; ///< Flag indicating whether the manifest was checked for a torn tail, guarded by `manifestMutex`.
+
+public:
+    /**
+     * @brief Constructs the manager.
+     *
+     * @param path The base path for storing the replications.
+     */
+    explicit ConcurrentOutputManager(const std::string &path) : basePath(path) {}
+
+    ConcurrentOutputManager(const ConcurrentOutputManager &) = delete;
+    ConcurrentOutputManager &operator=(const ConcurrentOutputManager &) = delete;
+
+    /**
+     * @brief Sets the name of the replications, call before the workers start.
+     *
+     * @param replicationName The name, followed by the replication number.
+     */
+    void setName(const std::string &replicationName) { name = replicationName; }
+
+    /**
+     * @brief Enables or disables the manifest, call before the workers start.
+     *
+     * Disabled by default.
+     *
+     * @param enabled True to record finished replications in the manifest.
+     */
+    void setManifestEnabled(bool enabled) { manifestEnabled = enabled; }
+
+    /**
+     * @brief Enables or disables reusing the writers of a handle, call before the workers start.
+     *
+     * @param enabled True to retarget the writers of a handle at its next replication.
+     */
+    void setPooled(bool enabled) { pooled = enabled; }
+
+    /**
+     * @brief Sets the number of the next replication, call before the workers start.
+     *
+     * @param id The number of the next replication.
+     */
+    void setNextId(int id) { counter.store(id, std::memory_order_relaxed); }
+
+    /**
+     * @brief Creates a handle with a new replication. Safe to call from any thread.
+     *
+     * @return The handle, with its writers initialised for the new replication.
+     * @throws std::runtime_error If the storage of the replication cannot be created.
+     */
+    std::unique_ptr<Handle> newReplication()
+    {
+        auto handle = std::make_unique<Handle>(*this);
+        newReplication(*handle);
+        return handle;
+    }
+
+    /**
+     * @brief Finishes the replication of a handle and starts a new one on it. Safe to call from any thread.
+     *
+     * @param handle The handle, used by the calling thread only.
+     * @throws std::runtime_error If the storage of the replication cannot be created.
+     */
+    void newReplication(Handle &handle)
+    {
+        handle.newReplication(counter.fetch_add(1, std::memory_order_relaxed));
+    }
+};
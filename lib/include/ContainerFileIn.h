@@ -0,0 +1,287 @@
+#pragma once
+
+#include "ContainerFormat.h"
+#include "LittleEndian.h"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <span>
+#include <stdexcept>
+#include <cstdint>
+#include <type_traits>
+#include <format>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Reads the streams of a replication container file.
+ *
+ * The container is memory-mapped and its stream directory parsed on `open()`. Streams are
+ * usually read through a `ContainerStreamIn` attached to the container; all streams of a
+ * replication then share one mapping and one `open()` call.
+ *
+ * A container may also be a byte range of a larger file, as in the segments of a replication
+ * archive; only that range is mapped.
+ *
+ * Views returned by `chunk()` stay valid until the container is closed.
+ */
+class ContainerFileIn
+{
+public:
+    static constexpr uint64_t WholeFile = UINT64_MAX; ///< Size selecting the rest of the file.
+
+    /**
+     * @brief Location of a chunk in the file.
+     */
+    struct Chunk
+    {
+        uint64_t offset; ///< File offset of the payload.
+        uint32_t size;   ///< Size of the payload in bytes.
+    };
+
+    /**
+     * @brief A named stream and its chunks.
+     */
+    struct Stream
+    {
+        std::string name;          ///< Name of the stream.
+        uint64_t records = 0;      ///< Number of records in the stream.
+        std::vector<Chunk> chunks; ///< Chunks of the stream in order.
+    };
+
+private:
+    std::string path;                 ///< Path of the container file.
+    uint64_t rangeOffset = 0;         ///< File offset of the container.
+    uint64_t rangeSize = WholeFile;   ///< Size of the container in bytes.
+    std::vector<Stream> streams;      ///< Streams listed in the directory.
+    void *mapAddress = nullptr;       ///< Start of the page-aligned mapping.
+    size_t mapLength = 0;             ///< Length of the page-aligned mapping.
+    const uint8_t *mapping = nullptr; ///< Start of the container inside the mapping.
+    size_t mappingSize = 0;           ///< Size of the container in bytes.
+    bool opened = false;              ///< Flag indicating whether the container is open.
+
+public:
+    ContainerFileIn() = default;
+
+    /**
+     * @brief Constructs a container reader for a file opened on first use.
+     *
+     * @param file The path of the container file.
+     * @param offset The file offset of the container.
+     * @param size The size of the container in bytes, `WholeFile` for the rest of the file.
+     */
+    explicit ContainerFileIn(const std::string &file, uint64_t offset = 0, uint64_t size = WholeFile)
+        : path(file), rangeOffset(offset), rangeSize(size) {}
+
+    /**
+     * @brief Destructor that releases the mapping.
+     */
+    ~ContainerFileIn() { close(); }
+
+    ContainerFileIn(const ContainerFileIn &) = delete;
+    ContainerFileIn &operator=(const ContainerFileIn &) = delete;
+
+    /**
+     * @brief Gets the path of the container file.
+     */
+    const std::string &getPath() const { return path; }
+
+    /**
+     * @brief Checks whether the container is open.
+     */
+    bool isOpen() const { return opened; }
+
+    /**
+     * @brief Opens the container file given on construction, unless it is already open.
+     *
+     * @throws std::runtime_error If the file cannot be opened or its directory is invalid.
+     */
+    void ensureOpen()
+    {
+        if (!opened)
+        {
+            open(path, rangeOffset, rangeSize);
+        }
+    }
+
+    /**
+     * @brief Opens and maps a container file and reads its stream directory.
+     *
+     * @param file The path of the container file.
+     * @param offset The file offset of the container.
+     * @param size The size of the container in bytes, `WholeFile` for the rest of the file.
+     * @throws std::runtime_error If the file cannot be opened or its directory is invalid.
+     */
+    void open(std::string_view file, uint64_t offset = 0, uint64_t size = WholeFile)
+    {
+        close();
+        path = file;
+        rangeOffset = offset;
+        rangeSize = size;
+
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error(std::format("Failed to stat file: {}", file));
+        }
+
+        uint64_t fileSize = static_cast<uint64_t>(info.st_size);
+        if (offset > fileSize)
+        {
+            ::close(fd);
+            throw std::runtime_error(std::format("Invalid container file: {}", file));
+        }
+        if (size == WholeFile)
+        {
+            size = fileSize - offset;
+        }
+        if (size < ContainerFormat::TrailerSize || fileSize - offset < size)
+        {
+            ::close(fd);
+            throw std::runtime_error(std::format("Invalid container file: {}", file));
+        }
+
+        // mmap needs a page-aligned offset
+        uint64_t pageSize = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        uint64_t alignedOffset = offset - offset % pageSize;
+        size_t length = static_cast<size_t>(size + (offset - alignedOffset));
+        void *address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+        ::close(fd);
+        if (address == MAP_FAILED)
+        {
+            throw std::runtime_error(std::format("Failed to map file: {}", file));
+        }
+        mapAddress = address;
+        mapLength = length;
+        mapping = static_cast<const uint8_t *>(address) + (offset - alignedOffset);
+        mappingSize = static_cast<size_t>(size);
+
+        try
+        {
+            readDirectory();
+        }
+        catch (const std::exception &)
+        {
+            close();
+            throw;
+        }
+        opened = true;
+    }
+
+    /**
+     * @brief Releases the mapping.
+     */
+    void close() noexcept
+    {
+        if (mapAddress)
+        {
+            ::munmap(mapAddress, mapLength);
+        }
+        mapAddress = nullptr;
+        mapLength = 0;
+        mapping = nullptr;
+        mappingSize = 0;
+        streams.clear();
+        opened = false;
+    }
+
+    /**
+     * @brief Gets the streams listed in the directory.
+     */
+    const std::vector<Stream> &getStreams() const { return streams; }
+
+    /**
+     * @brief Finds a stream by name.
+     *
+     * @param name The name of the stream.
+     * @return The stream, or nullptr if the container has no such stream.
+     */
+    const Stream *find(std::string_view name) const
+    {
+        for (const auto &stream : streams)
+        {
+            if (stream.name == name)
+            {
+                return &stream;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Gets a view of the payload of a chunk.
+     *
+     * @param chunk The chunk as listed in the directory.
+     * @return A view of the payload inside the mapping.
+     */
+    std::span<const uint8_t> chunk(const Chunk &chunk) const { return {mapping + chunk.offset, chunk.size}; }
+
+private:
+    /**
+     * @brief Parses and validates the trailer and the stream directory.
+     *
+     * @throws std::runtime_error If the directory is missing or corrupted.
+     */
+    void readDirectory()
+    {
+        size_t position = mappingSize - ContainerFormat::TrailerSize;
+        uint64_t directoryOffset = LittleEndian::load<uint64_t>(mapping + position);
+        uint32_t magic = LittleEndian::load<uint32_t>(mapping + position + sizeof(directoryOffset));
+        if (magic != ContainerFormat::Magic || directoryOffset > position)
+        {
+            throw std::runtime_error(std::format("Invalid container file: {}", path));
+        }
+
+        size_t end = position;
+        position = static_cast<size_t>(directoryOffset);
+        auto get = [&](auto &value)
+        {
+            if (end - position < sizeof(value))
+            {
+                throw std::runtime_error(std::format("Invalid container file: {}", path));
+            }
+            value = LittleEndian::load<std::remove_cvref_t<decltype(value)>>(mapping + position);
+            position += sizeof(value);
+        };
+
+        uint32_t streamCount;
+        get(streamCount);
+        for (uint32_t i = 0; i < streamCount; ++i)
+        {
+            Stream stream;
+            uint16_t nameSize;
+            get(nameSize);
+            if (end - position < nameSize)
+            {
+                throw std::runtime_error(std::format("Invalid container file: {}", path));
+            }
+            stream.name.assign(reinterpret_cast<const char *>(mapping + position), nameSize);
+            position += nameSize;
+
+            uint32_t chunkCount;
+            get(stream.records);
+            get(chunkCount);
+            for (uint32_t j = 0; j < chunkCount; ++j)
+            {
+                Chunk chunk;
+                get(chunk.offset);
+                get(chunk.size);
+                if (chunk.offset > directoryOffset || directoryOffset - chunk.offset < chunk.size)
+                {
+                    throw std::runtime_error(std::format("Invalid container file: {}", path));
+                }
+                stream.chunks.push_back(chunk);
+            }
+            streams.push_back(std::move(stream));
+        }
+    }
+};
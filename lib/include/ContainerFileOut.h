@@ -0,0 +1,264 @@
+#pragma once
+
+#include "ContainerFormat.h"
+#include "LittleEndian.h"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+#include <format>
+
+/**
+ * @brief Writes the streams of a replication into one container file.
+ *
+ * Streams are registered by name with `addStream()` and receive chunks of records with
+ * `append()`, usually through a `ContainerStreamOut` attached to the container. The stream
+ * directory is written when the container is closed (see `ContainerFormat` for the layout).
+ *
+ * A container can also be appended to the end of an existing file, as done for segments of
+ * a replication archive. Its offsets are relative to its own start, `getBaseOffset()` and
+ * `getSize()` give its byte range in the file.
+ *
+ * An instance is not thread-safe.
+ */
+class ContainerFileOut
+{
+private:
+    /**
+     * @brief Location of a chunk in the file.
+     */
+    struct Chunk
+    {
+        uint64_t offset; ///< File offset of the payload.
+        uint32_t size;   ///< Size of the payload in bytes.
+    };
+
+    /**
+     * @brief A named stream and its chunks.
+     */
+    struct Stream
+    {
+        std::string name;          ///< Name of the stream.
+        uint64_t records = 0;      ///< Number of records in the stream.
+        std::vector<Chunk> chunks; ///< Chunks of the stream in order.
+    };
+
+    std::ofstream outFile;       ///< Output file stream of the container.
+    std::vector<Stream> streams; ///< Registered streams, indexed by stream id.
+    uint64_t baseOffset = 0;     ///< File offset of the start of the container.
+    uint64_t fileOffset = 0;     ///< Offset of the next write relative to the start of the container.
+
+public:
+    ContainerFileOut() = default;
+
+    /**
+     * @brief Destructor that writes the stream directory and closes the file.
+     */
+    ~ContainerFileOut() { close(); }
+
+    ContainerFileOut(const ContainerFileOut &) = delete;
+    ContainerFileOut &operator=(const ContainerFileOut &) = delete;
+
+    /**
+     * @brief Opens a container file.
+     *
+     * @param file The path of the container file.
+     * @param append If true, the container is appended to the end of an existing file instead
+     *               of truncating it.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(std::string_view file, bool append = false)
+    {
+        close();
+        std::string path(file);
+        baseOffset = 0;
+        if (append && std::filesystem::exists(path))
+        {
+            baseOffset = std::filesystem::file_size(path);
+        }
+        outFile.open(path, std::ios::binary | std::ios::out | (append ? std::ios::app : std::ios::trunc));
+        if (!outFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+        streams.clear();
+        fileOffset = 0;
+    }
+
+    /**
+     * @brief Writes the stream directory and closes the file.
+     *
+     * A failure is reported as a warning, the container is then incomplete and must not be
+     * referenced (e.g. from an archive index).
+     *
+     * @return True if the container was written completely or no file was open.
+     */
+    bool close() noexcept
+    {
+        if (!outFile.is_open())
+        {
+            return true;
+        }
+
+        bool written = true;
+        try
+        {
+            writeDirectory();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: Failed to write container directory: " << e.what() << std::endl;
+            written = false;
+        }
+        outFile.close();
+        if (written && !outFile)
+        {
+            std::cerr << "Warning: Failed to close container file" << std::endl;
+            written = false;
+        }
+        return written;
+    }
+
+    /**
+     * @brief Checks whether the container file is open.
+     */
+    bool isOpen() const { return outFile.is_open(); }
+
+    /**
+     * @brief Gets the file offset at which the container starts.
+     */
+    uint64_t getBaseOffset() const { return baseOffset; }
+
+    /**
+     * @brief Gets the number of bytes written to the container.
+     *
+     * After `close()` this includes the directory and the trailer.
+     */
+    uint64_t getSize() const { return fileOffset; }
+
+    /**
+     * @brief Registers a stream.
+     *
+     * Registering an existing name returns its id, further chunks are appended to it.
+     *
+     * @param name The name of the stream.
+     * @return The id of the stream.
+     * @throws std::runtime_error If the container is not open or the name is too long.
+     */
+    uint32_t addStream(std::string_view name)
+    {
+        if (!outFile.is_open())
+        {
+            throw std::runtime_error("No container opened for writing");
+        }
+        if (name.size() > std::numeric_limits<uint16_t>::max())
+        {
+            throw std::runtime_error(std::format("Stream name too long: {}", name));
+        }
+
+        for (size_t i = 0; i < streams.size(); ++i)
+        {
+            if (streams[i].name == name)
+            {
+                return static_cast<uint32_t>(i);
+            }
+        }
+        streams.push_back({std::string(name), 0, {}});
+        return static_cast<uint32_t>(streams.size() - 1);
+    }
+
+    /**
+     * @brief Appends a chunk of whole records to a stream.
+     *
+     * @param id The id of the stream.
+     * @param data The length-prefixed records.
+     * @param size The number of bytes.
+     * @param records The number of records in the chunk.
+     * @throws std::runtime_error If the container is not open, the id is unknown or writing fails.
+     */
+    void append(uint32_t id, const uint8_t *data, size_t size, uint64_t records)
+    {
+        if (!outFile.is_open())
+        {
+            throw std::runtime_error("No container opened for writing");
+        }
+        if (id >= streams.size())
+        {
+            throw std::out_of_range("Stream id out of range");
+        }
+        if (size == 0)
+        {
+            return;
+        }
+
+        uint8_t header[ContainerFormat::ChunkHeaderSize];
+        uint32_t chunkSize = static_cast<uint32_t>(size);
+        LittleEndian::store(header, id);
+        LittleEndian::store(header + 4, chunkSize);
+        outFile.write(reinterpret_cast<const char *>(header), sizeof(header));
+        outFile.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+        if (!outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+
+        streams[id].chunks.push_back({fileOffset + sizeof(header), chunkSize});
+        streams[id].records += records;
+        fileOffset += sizeof(header) + size;
+    }
+
+    /**
+     * @brief Flushes the file stream.
+     */
+    void flush()
+    {
+        if (outFile.is_open())
+        {
+            outFile.flush();
+        }
+    }
+
+private:
+    /**
+     * @brief Appends the stream directory and the trailer.
+     */
+    void writeDirectory()
+    {
+        std::vector<uint8_t> directory;
+        auto put = [&directory](auto value)
+        {
+            uint8_t bytes[sizeof(value)];
+            LittleEndian::store(bytes, value);
+            directory.insert(directory.end(), bytes, bytes + sizeof(value));
+        };
+
+        put(static_cast<uint32_t>(streams.size()));
+        for (const auto &stream : streams)
+        {
+            put(static_cast<uint16_t>(stream.name.size()));
+            directory.insert(directory.end(), stream.name.begin(), stream.name.end());
+            put(stream.records);
+            put(static_cast<uint32_t>(stream.chunks.size()));
+            for (const auto &chunk : stream.chunks)
+            {
+                put(chunk.offset);
+                put(chunk.size);
+            }
+        }
+        put(fileOffset);
+        put(ContainerFormat::Magic);
+
+        outFile.write(reinterpret_cast<const char *>(directory.data()), static_cast<std::streamsize>(directory.size()));
+        outFile.flush();
+        if (!outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+        fileOffset += directory.size();
+    }
+};
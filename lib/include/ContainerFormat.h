@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief Layout constants of replication container files.
+ *
+ * A container stores all named streams of a replication in one file. Every stream is
+ * written as a sequence of chunks holding whole length-prefixed records (the `BinFileOut`
+ * format); chunks of different streams may interleave. A stream directory and a trailer
+ * are appended when the container is closed:
+ *
+ * [chunk: 4 bytes stream id | 4 bytes payload size | payload]...
+ * [directory: 4 bytes stream count | per stream: 2 bytes name length | name |
+ *  8 bytes record count | 4 bytes chunk count | per chunk: 8 bytes payload offset | 4 bytes payload size]
+ * [trailer: 8 bytes directory offset | 4 bytes magic]
+ *
+ * All integers are little-endian. Offsets are relative to the start of the container, so
+ * containers can be stored back to back in one file.
+ */
+struct ContainerFormat
+{
+    static constexpr std::string_view Extension = ".rep"; ///< File extension of container files.
+    static constexpr uint32_t Magic = 0x544E4352;          ///< Marks the end of a container file ("RCNT").
+    static constexpr size_t ChunkHeaderSize = 8;           ///< Size of a chunk header in bytes.
+    static constexpr size_t TrailerSize = 12;              ///< Size of the trailer in bytes.
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "OutputManager.h"
+#include "ContainerFileOut.h"
+#include "ContainerFormat.h"
+#include <memory>
+#include <string>
+
+/**
+ * @brief Output manager storing every replication in a single container file.
+ *
+ * Instead of a directory with one file per writer, `newReplication()` creates the container
+ * `<base path><replication name>.rep` and derived classes register logical streams in it
+ * with `registerStream()` from their `init()`. The writers must use a file handler that can
+ * be attached to a container, such as `ContainerStreamOut`.
+ */
+class ContainerOutputManager : public OutputManager
+{
+private:
+    std::shared_ptr<ContainerFileOut> container; ///< Container of the current replication.
+
+public:
+    ContainerOutputManager() : OutputManager() {}
+    ContainerOutputManager(const std::string &path) : OutputManager(path) {}
+
+    /**
+     * @brief Closes all writers and the container of the current replication.
+     */
+    ~ContainerOutputManager() override { closeAllWriters(); }
+
+    /**
+     * @brief Closes all registered writers, then writes the stream directory of the container.
+     */
+    void closeAllWriters() noexcept override
+    {
+        OutputManager::closeAllWriters();
+        closeContainer();
+    }
+
+    /**
+     * @brief Gets the container of the current replication.
+     *
+     * @return A shared pointer to the container, or nullptr before the first replication.
+     */
+    std::shared_ptr<ContainerFileOut> getContainer() const { return container; }
+
+    /**
+     * @brief Creates a writer for a logical stream of the current replication and registers it.
+     *
+     * @tparam W The writer type, its file handler must provide `attach()` for containers.
+     * @param name The name of the stream.
+     * @return A shared pointer to the registered writer.
+     */
+    template <WriterConcept W>
+    std::shared_ptr<W> registerStream(const std::string &name)
+    {
+        auto writer = std::make_shared<W>(name);
+        writer->getFile().attach(container);
+        auto registered = writer;
+        registerWriter(registered);
+        return writer;
+    }
+
+protected:
+    /**
+     * @brief Writes the stream directory of the container and closes it.
+     *
+     * @return False if the container could not be written completely.
+     */
+    bool closeContainer() noexcept
+    {
+        return !container || container->close();
+    }
+
+    /**
+     * @brief Keeps creating the writers with `init()` in pooled mode.
+     *
+     * The streams are attached to the container of their replication and cannot be retargeted.
+     */
+    bool retargetWriters(const std::string &) override { return false; }
+
+    /**
+     * @brief Creates the container file of the current replication.
+     *
+     * @throws std::runtime_error If the container cannot be created.
+     */
+    void createReplicationStorage() override
+    {
+        openContainer(getBasePath() + getCurrentReplicationName() + std::string(ContainerFormat::Extension));
+    }
+
+    /**
+     * @brief Opens a new container for the current replication.
+     *
+     * @param path The path of the container file.
+     * @param append If true, the container is appended to the end of an existing file.
+     * @throws std::runtime_error If the container cannot be opened.
+     */
+    void openContainer(const std::string &path, bool append = false)
+    {
+        container = std::make_shared<ContainerFileOut>();
+        container->open(path, append);
+    }
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Replication.h"
+#include "ContainerFileIn.h"
+#include "ContainerFormat.h"
+#include <memory>
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Replication stored in a single container file.
+ *
+ * The replication `name` below a base path is read from `<base path><name>.rep`, or from
+ * the byte range given by `setContainerLocation()` for replications in an archive. Derived
+ * classes register readers for its logical streams with `registerStream()` from their
+ * `init()`. All readers share one `ContainerFileIn`, which is opened by the first reader
+ * that needs it.
+ *
+ * `InputManager` recognizes replications of this kind by `ContainerExtension` and lists
+ * container files instead of directories for them.
+ */
+class ContainerReplication : public Replication
+{
+public:
+    static constexpr std::string_view ContainerExtension = ContainerFormat::Extension; ///< Extension of replication files.
+
+private:
+    std::shared_ptr<ContainerFileIn> container; ///< Container shared by the readers.
+
+public:
+    ContainerReplication() : Replication() {}
+    ContainerReplication(const std::string &name) : Replication(name) {}
+
+    /**
+     * @brief Gets the path of the container file of this replication.
+     *
+     * @return The path of the container file.
+     */
+    std::string getContainerPath() const { return getBasePath() + getName() + std::string(ContainerExtension); }
+
+    /**
+     * @brief Reads the replication from a byte range of a file instead of its container file.
+     *
+     * Must be called before `init()`.
+     *
+     * @param path The path of the file holding the container.
+     * @param offset The file offset of the container.
+     * @param size The size of the container in bytes.
+     */
+    void setContainerLocation(const std::string &path, uint64_t offset, uint64_t size)
+    {
+        container = std::make_shared<ContainerFileIn>(path, offset, size);
+    }
+
+    /**
+     * @brief Gets the container shared by the readers of this replication.
+     *
+     * @return A shared pointer to the container, not yet opened before the first read.
+     */
+    std::shared_ptr<ContainerFileIn> getContainer()
+    {
+        if (!container)
+        {
+            container = std::make_shared<ContainerFileIn>(getContainerPath());
+        }
+        return container;
+    }
+
+    /**
+     * @brief Creates a reader for a logical stream of this replication and registers it.
+     *
+     * @tparam R The reader type, its file handler must provide `attach()` for containers.
+     * @param name The name of the stream.
+     * @return A shared pointer to the registered reader.
+     */
+    template <ReaderConcept R>
+    std::shared_ptr<R> registerStream(const std::string &name)
+    {
+        auto reader = std::make_shared<R>(name);
+        reader->getFile().attach(getContainer());
+        registerReader(reader);
+        return reader;
+    }
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "FileIn.h"
+#include "ContainerFileIn.h"
+#include <memory>
+#include <span>
+#include <string>
+#include <stdexcept>
+#include <cstdint>
+#include <format>
+
+/**
+ * @brief Class for reading length-prefixed binary data from a stream of a container file.
+ *
+ * This class inherits from `FileIn` and reads the same record format as `BinFileIn`
+ * from a named stream of a shared `ContainerFileIn`. The container is set with `attach()`;
+ * `open()` takes the stream name instead of a file path. Records are returned as views
+ * into the container's mapping, as with `MappedBinFileIn`.
+ */
+class ContainerStreamIn : public FileIn<std::span<const uint8_t>>
+{
+private:
+    std::shared_ptr<ContainerFileIn> container;      ///< Container holding the stream.
+    const ContainerFileIn::Stream *stream = nullptr; ///< Open stream.
+    std::span<const uint8_t> current;                ///< Payload of the current chunk.
+    size_t position = 0;                             ///< Offset of the next record in `current`.
+    size_t nextChunk = 0;                            ///< Index of the next chunk of the stream.
+
+public:
+    /**
+     * @brief Sets the container the stream is read from.
+     *
+     * @param source The shared container.
+     */
+    void attach(std::shared_ptr<ContainerFileIn> source)
+    {
+        close();
+        container = std::move(source);
+    }
+
+    /**
+     * @brief Opens a stream of the attached container.
+     *
+     * The container itself is opened on first use.
+     *
+     * @param name The name of the stream.
+     * @throws std::runtime_error If no container is attached, it cannot be opened or has no such stream.
+     */
+    void open(std::string_view name) override
+    {
+        close();
+        if (!container)
+        {
+            throw std::runtime_error("No container attached");
+        }
+        container->ensureOpen();
+        stream = container->find(name);
+        if (!stream)
+        {
+            throw std::runtime_error(std::format("Stream not found: {}", name));
+        }
+    }
+
+    /**
+     * @brief Closes the stream.
+     */
+    void close() noexcept override
+    {
+        stream = nullptr;
+        current = {};
+        position = 0;
+        nextChunk = 0;
+    }
+
+    /**
+     * @brief Gets the number of records in the stream from the container directory.
+     *
+     * @return The number of records.
+     * @throws std::runtime_error If no stream is open.
+     */
+    uint64_t recordCount() const
+    {
+        if (!stream)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+        return stream->records;
+    }
+
+    /**
+     * @brief Reads the next record of the stream.
+     *
+     * @return A view of the record bytes, or an empty view at the end of the stream.
+     * @throws std::runtime_error If no stream is open or the record is truncated.
+     */
+    std::span<const uint8_t> read() override
+    {
+        if (!stream)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        // Chunks only hold whole records
+        while (position >= current.size())
+        {
+            if (nextChunk >= stream->chunks.size())
+            {
+                return {};
+            }
+            current = container->chunk(stream->chunks[nextChunk++]);
+            position = 0;
+        }
+
+        if (current.size() - position < sizeof(uint32_t))
+        {
+            throw std::runtime_error("Failed to read data size");
+        }
+
+        // Read size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = 0;
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            dataSize |= static_cast<uint32_t>(current[position + i]) << (i * 8);
+        }
+        position += sizeof(dataSize);
+
+        if (current.size() - position < dataSize)
+        {
+            throw std::runtime_error("Failed to read data content");
+        }
+
+        std::span<const uint8_t> record = current.subspan(position, dataSize);
+        position += dataSize;
+        return record;
+    }
+};
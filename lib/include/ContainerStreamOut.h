@@ -0,0 +1,158 @@
+#pragma once
+
+#include "FileOut.h"
+#include "ContainerFileOut.h"
+#include <vector>
+#include <memory>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+/**
+ * @brief Class for writing length-prefixed binary data to a stream of a container file.
+ *
+ * This class inherits from `FileOut` and writes the same record format as `BinFileOut`
+ * (4-byte little-endian size followed by the data content), but into a named stream of a
+ * shared `ContainerFileOut` instead of a file of its own. The container is set with
+ * `attach()`; `open()` takes the stream name instead of a file path.
+ *
+ * Records are collected into chunks that are appended to the container once full, on
+ * `flush()` or on `close()`.
+ */
+class ContainerStreamOut : public FileOut<std::vector<uint8_t>>
+{
+public:
+    static constexpr size_t DefaultChunkSize = 64 * 1024; ///< Default number of bytes per chunk.
+
+private:
+    std::shared_ptr<ContainerFileOut> container; ///< Container receiving the chunks.
+    std::vector<uint8_t> buffer;                 ///< Records of the chunk being collected.
+    uint64_t bufferedRecords = 0;                ///< Number of records in `buffer`.
+    size_t chunkSize;                            ///< Number of bytes collected before a chunk is appended.
+    uint32_t streamId = 0;                       ///< Id of the stream in the container.
+    bool opened = false;                         ///< Flag indicating whether a stream is open.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of bytes per chunk.
+     */
+    explicit ContainerStreamOut(size_t size = DefaultChunkSize) : chunkSize(size > 0 ? size : DefaultChunkSize) {}
+
+    /**
+     * @brief Destructor that appends buffered records to the container.
+     */
+    ~ContainerStreamOut() { close(); }
+
+    /**
+     * @brief Sets the container the stream is written to.
+     *
+     * @param target The shared container.
+     */
+    void attach(std::shared_ptr<ContainerFileOut> target)
+    {
+        close();
+        container = std::move(target);
+    }
+
+    /**
+     * @brief Opens a stream of the attached container.
+     *
+     * @param name The name of the stream.
+     * @throws std::runtime_error If no container is attached or it is not open.
+     */
+    void open(const std::string_view name) override
+    {
+        close();
+        if (!container)
+        {
+            throw std::runtime_error("No container attached");
+        }
+        streamId = container->addStream(name);
+        buffer.reserve(chunkSize);
+        opened = true;
+    }
+
+    /**
+     * @brief Appends buffered records to the container and closes the stream.
+     */
+    void close() noexcept override
+    {
+        if (!opened)
+        {
+            return;
+        }
+
+        try
+        {
+            writeChunk();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: Failed to write container chunk: " << e.what() << std::endl;
+        }
+        buffer.clear();
+        bufferedRecords = 0;
+        opened = false;
+    }
+
+    /**
+     * @brief Writes binary data to the stream.
+     *
+     * Writes the size of the data (4 bytes, little-endian) followed by the actual data content.
+     *
+     * @param data The vector of bytes to write to the stream.
+     * @throws std::runtime_error If the stream is not open or writing fails.
+     */
+    void write(const std::vector<uint8_t> &data) override
+    {
+        if (!opened)
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+
+        // Write size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = static_cast<uint32_t>(data.size());
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            buffer.push_back(static_cast<uint8_t>(dataSize >> (i * 8)));
+        }
+        buffer.insert(buffer.end(), data.begin(), data.end());
+        ++bufferedRecords;
+
+        if (buffer.size() >= chunkSize)
+        {
+            writeChunk();
+        }
+    }
+
+    /**
+     * @brief Appends buffered records to the container and flushes it.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void flush() override
+    {
+        if (opened)
+        {
+            writeChunk();
+            container->flush();
+        }
+    }
+
+private:
+    /**
+     * @brief Appends the collected records to the container as one chunk.
+     */
+    void writeChunk()
+    {
+        if (buffer.empty())
+        {
+            return;
+        }
+        container->append(streamId, buffer.data(), buffer.size(), bufferedRecords);
+        buffer.clear();
+        bufferedRecords = 0;
+    }
+};
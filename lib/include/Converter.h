@@ -47,4 +47,20 @@ public:
      * @return The converted data of type `T`.
      */
     virtual T convert(const O &data) = 0;
-};
\ No newline at end of file
+
+    /**
+     * @brief Encodes data of type `T` into a reusable output object.
+     * 
+     * Replaces the contents of `out` with the converted data. Derived classes override
+     * this function to fill `out` in place, reusing its capacity, so that encoding a
+     * record needs no heap allocation once `out` is large enough. The default
+     * implementation assigns the result of `convert()`.
+     * 
+     * @param data The input data of type `T`.
+     * @param out The output object receiving the converted data.
+     */
+    virtual void encode(const T &data, O &out)
+    {
+        out = convert(data);
+    }
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <nmmintrin.h>
+#endif
+
+/**
+ * @brief CRC-32C (Castagnoli) checksum.
+ *
+ * On x86 processors with SSE4.2 the checksum is computed with the `crc32` instruction,
+ * eight bytes at a time. The instruction set is detected at run time, so no special
+ * compiler flags are needed; other processors use a table-driven implementation.
+ */
+class Crc32c
+{
+public:
+    /**
+     * @brief Computes the checksum of a buffer.
+     *
+     * @param data The bytes to checksum.
+     * @param size The number of bytes.
+     * @param crc The checksum of the preceding bytes, to checksum data in pieces.
+     * @return The checksum of all bytes so far.
+     */
+    static uint32_t compute(const uint8_t *data, size_t size, uint32_t crc = 0)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        static const bool hardware = __builtin_cpu_supports("sse4.2");
+        if (hardware)
+        {
+            return ~computeHardware(data, size, ~crc);
+        }
+#endif
+        return ~computeTable(data, size, ~crc);
+    }
+
+private:
+#if defined(__x86_64__) || defined(__i386__)
+    /**
+     * @brief Computes the raw checksum with the SSE4.2 `crc32` instruction.
+     */
+    __attribute__((target("sse4.2"))) static uint32_t computeHardware(const uint8_t *data, size_t size, uint32_t crc)
+    {
+#if defined(__x86_64__)
+        uint64_t crc64 = crc;
+        while (size >= sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            data += sizeof(word);
+            size -= sizeof(word);
+        }
+        crc = static_cast<uint32_t>(crc64);
+#endif
+        while (size >= sizeof(uint32_t))
+        {
+            uint32_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = _mm_crc32_u32(crc, word);
+            data += sizeof(word);
+            size -= sizeof(word);
+        }
+        while (size-- > 0)
+        {
+            crc = _mm_crc32_u8(crc, *data++);
+        }
+        return crc;
+    }
+#endif
+
+    /**
+     * @brief Builds the lookup table for the reflected polynomial 0x82F63B78.
+     */
+    static constexpr std::array<uint32_t, 256> makeTable()
+    {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                value = (value & 1) ? (value >> 1) ^ 0x82F63B78u : value >> 1;
+            }
+            table[i] = value;
+        }
+        return table;
+    }
+
+    /**
+     * @brief Computes the raw checksum one byte at a time with a lookup table.
+     */
+    static uint32_t computeTable(const uint8_t *data, size_t size, uint32_t crc)
+    {
+        static constexpr std::array<uint32_t, 256> table = makeTable();
+        while (size-- > 0)
+        {
+            crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        }
+        return crc;
+    }
+};
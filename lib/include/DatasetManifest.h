@@ -0,0 +1,366 @@
+#pragma once
+
+#include "Crc32c.h"
+#include "LittleEndian.h"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <fstream>
+#include <filesystem>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cstdint>
+#include <type_traits>
+#include <charconv>
+#include <utility>
+#include <format>
+
+/**
+ * @brief Manifest of the replications in a results folder.
+ *
+ * `OutputManager` appends an entry to `manifest.bin` in its base path whenever a replication
+ * is finished, listing its name, numeric id and, for every writer, the stream file with its
+ * record count and size. `InputManager` and the folder browser read the manifest instead of
+ * scanning and sorting the directory tree.
+ *
+ * Format (little-endian):
+ *
+ * [4 bytes magic]
+ * [entry: 2 bytes name length | name | 8 bytes id | 4 bytes stream count |
+ *  per stream: 2 bytes file length | file | 8 bytes record count | 8 bytes size |
+ *  4 bytes CRC-32C of the preceding entry bytes]...
+ *
+ * Loading stops at the first incomplete or corrupted entry, which is what an interrupted
+ * append leaves behind. When a name occurs more than once, the last entry wins. The manifest
+ * is only current while nothing else changed the folder after its last append (see
+ * `isCurrent()`), otherwise readers fall back to scanning.
+ */
+class DatasetManifest
+{
+public:
+    static constexpr uint32_t Magic = 0x4E414D52;                ///< Marks a manifest file ("RMAN").
+    static constexpr std::string_view FileName = "manifest.bin"; ///< File name of the manifest.
+    static constexpr int64_t NoId = -1;                          ///< Id of replications without a number.
+
+    /**
+     * @brief A stream file of a replication.
+     */
+    struct Stream
+    {
+        std::string file;     ///< Path of the file relative to the replication.
+        uint64_t records = 0; ///< Number of records written.
+        uint64_t bytes = 0;   ///< Size of the file in bytes.
+    };
+
+    /**
+     * @brief A replication and its streams.
+     */
+    struct Entry
+    {
+        std::string name;            ///< Name of the replication.
+        int64_t id = NoId;           ///< Number of the replication.
+        std::vector<Stream> streams; ///< Stream files of the replication.
+    };
+
+private:
+    std::vector<Entry> entries;                     ///< Entries sorted like `InputManager::sortReplications()`.
+    std::unordered_map<std::string, size_t> lookup; ///< Position of every name in `entries`.
+    uint64_t validSize = 0;                         ///< Size of the valid part of the file in bytes.
+
+public:
+    /**
+     * @brief Gets the path of the manifest of a folder.
+     *
+     * @param basePath The folder, ending with a slash.
+     * @return The path of the manifest file.
+     */
+    static std::string pathFor(std::string_view basePath) { return std::format("{}{}", basePath, FileName); }
+
+    /**
+     * @brief Checks whether the manifest of a folder exists and is up to date.
+     *
+     * Adding or removing a replication changes the modification time of the folder, while
+     * appending to the manifest does not. The manifest is current if it was written after
+     * the last such change.
+     *
+     * @param basePath The folder, ending with a slash.
+     * @return True if the manifest can be used instead of scanning the folder.
+     */
+    static bool isCurrent(std::string_view basePath)
+    {
+        std::error_code error;
+        auto manifestTime = std::filesystem::last_write_time(pathFor(basePath), error);
+        if (error)
+        {
+            return false;
+        }
+        auto folderTime = std::filesystem::last_write_time(std::filesystem::path(basePath), error);
+        return !error && manifestTime >= folderTime;
+    }
+
+    /**
+     * @brief Gets the entries in sorted order.
+     */
+    const std::vector<Entry> &getEntries() const { return entries; }
+
+    /**
+     * @brief Gets the number of replications in the manifest.
+     */
+    size_t size() const { return entries.size(); }
+
+    /**
+     * @brief Gets the size of the part of the file read by `load()`.
+     *
+     * Bytes beyond it are the remains of an interrupted append and must be truncated before
+     * appending further entries.
+     */
+    uint64_t getValidSize() const { return validSize; }
+
+    /**
+     * @brief Finds the entry of a replication.
+     *
+     * @param name The name of the replication.
+     * @return The entry, or nullptr if the manifest has none.
+     */
+    const Entry *find(std::string_view name) const
+    {
+        auto it = lookup.find(std::string(name));
+        return it == lookup.end() ? nullptr : &entries[it->second];
+    }
+
+    /**
+     * @brief Reads a manifest file.
+     *
+     * @param file The path of the manifest file.
+     * @return True if the file was read, otherwise the manifest is left empty.
+     */
+    bool load(const std::string &file)
+    {
+        entries.clear();
+        lookup.clear();
+        validSize = 0;
+
+        std::ifstream in(file, std::ios::binary | std::ios::in);
+        if (!in)
+        {
+            return false;
+        }
+        std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        uint32_t magic = 0;
+        if (buffer.size() < sizeof(magic))
+        {
+            return false;
+        }
+        magic = LittleEndian::load<uint32_t>(buffer.data());
+        if (magic != Magic)
+        {
+            return false;
+        }
+
+        size_t position = sizeof(magic);
+        auto get = [&](auto &value)
+        {
+            if (buffer.size() - position < sizeof(value))
+            {
+                return false;
+            }
+            value = LittleEndian::load<std::remove_cvref_t<decltype(value)>>(buffer.data() + position);
+            position += sizeof(value);
+            return true;
+        };
+        auto getString = [&](std::string &value)
+        {
+            uint16_t size;
+            if (!get(size) || buffer.size() - position < size)
+            {
+                return false;
+            }
+            value.assign(reinterpret_cast<const char *>(buffer.data() + position), size);
+            position += size;
+            return true;
+        };
+
+        validSize = position;
+        while (position < buffer.size())
+        {
+            size_t start = position;
+            Entry entry;
+            uint32_t streamCount;
+            if (!getString(entry.name) || !get(entry.id) || !get(streamCount))
+            {
+                break;
+            }
+
+            bool complete = true;
+            for (uint32_t i = 0; i < streamCount && complete; ++i)
+            {
+                Stream stream;
+                complete = getString(stream.file) && get(stream.records) && get(stream.bytes);
+                entry.streams.push_back(std::move(stream));
+            }
+
+            uint32_t crc;
+            uint32_t expected = complete ? Crc32c::compute(buffer.data() + start, position - start) : 0;
+            if (!complete || !get(crc) || crc != expected)
+            {
+                break;
+            }
+
+            auto it = lookup.find(entry.name);
+            if (it != lookup.end())
+            {
+                entries[it->second] = std::move(entry);
+            }
+            else
+            {
+                lookup.emplace(entry.name, entries.size());
+                entries.push_back(std::move(entry));
+            }
+            validSize = position;
+        }
+
+        sortEntries();
+        return true;
+    }
+
+    /**
+     * @brief Gets the number at the end of a replication name.
+     *
+     * @param name The replication name, e.g. "Replication12".
+     * @return The number, or `NoId` if the name does not end with one.
+     */
+    static int64_t idFromName(std::string_view name)
+    {
+        size_t start = name.find_last_not_of("0123456789") + 1;
+        int64_t id = NoId;
+        auto [end, error] = std::from_chars(name.data() + start, name.data() + name.size(), id);
+        return error == std::errc() && end == name.data() + name.size() ? id : NoId;
+    }
+
+    /**
+     * @brief Orders two replications by id if both have one, otherwise by name.
+     *
+     * This is the order of the manifest entries.
+     */
+    static bool before(int64_t idA, const std::string &nameA, int64_t idB, const std::string &nameB)
+    {
+        if (idA != NoId && idB != NoId)
+        {
+            return idA < idB;
+        }
+        return nameA < nameB;
+    }
+
+    /**
+     * @brief Sorts replication names in the order of the manifest entries.
+     *
+     * Names ending with a number are ordered by it, as entries are by their id, other names
+     * lexicographically. Used where replications are listed without a manifest.
+     *
+     * @param names The names to sort.
+     */
+    static void sortNames(std::vector<std::string> &names)
+    {
+        std::vector<std::pair<int64_t, std::string>> keyed;
+        keyed.reserve(names.size());
+        for (auto &name : names)
+        {
+            keyed.emplace_back(idFromName(name), std::move(name));
+        }
+        std::sort(keyed.begin(), keyed.end(), [](const auto &a, const auto &b)
+                  { return before(a.first, a.second, b.first, b.second); });
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            names[i] = std::move(keyed[i].second);
+        }
+    }
+
+    /**
+     * @brief Drops the remains of an interrupted append from the end of a manifest file.
+     *
+     * Reads the whole file, call it once before appending to an existing manifest.
+     *
+     * @param file The path of the manifest file, nothing happens if it does not exist.
+     * @throws std::filesystem::filesystem_error If the file cannot be truncated.
+     */
+    static void dropTornTail(const std::string &file)
+    {
+        DatasetManifest manifest;
+        if (manifest.load(file) && std::filesystem::file_size(file) > manifest.getValidSize())
+        {
+            std::filesystem::resize_file(file, manifest.getValidSize());
+        }
+    }
+
+    /**
+     * @brief Appends an entry to a manifest file, creating the file if needed.
+     *
+     * @param file The path of the manifest file.
+     * @param entry The entry to append.
+     * @throws std::runtime_error If a name is too long or writing fails.
+     */
+    static void append(const std::string &file, const Entry &entry)
+    {
+        std::vector<uint8_t> buffer;
+        auto put = [&buffer](auto value)
+        {
+            uint8_t bytes[sizeof(value)];
+            LittleEndian::store(bytes, value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+        };
+        auto putString = [&](const std::string &value)
+        {
+            if (value.size() > std::numeric_limits<uint16_t>::max())
+            {
+                throw std::runtime_error(std::format("Name too long: {}", value));
+            }
+            put(static_cast<uint16_t>(value.size()));
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        };
+
+        std::error_code error;
+        if (std::filesystem::file_size(file, error) == 0 || error)
+        {
+            put(Magic);
+        }
+        size_t start = buffer.size();
+        putString(entry.name);
+        put(entry.id);
+        put(static_cast<uint32_t>(entry.streams.size()));
+        for (const auto &stream : entry.streams)
+        {
+            putString(stream.file);
+            put(stream.records);
+            put(stream.bytes);
+        }
+        put(Crc32c::compute(buffer.data() + start, buffer.size() - start));
+
+        std::ofstream out(file, std::ios::binary | std::ios::out | std::ios::app);
+        out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        out.flush();
+        if (!out)
+        {
+            throw std::runtime_error(std::format("Failed to write file: {}", file));
+        }
+    }
+
+private:
+    /**
+     * @brief Sorts the entries by id, entries without one by name, and rebuilds the lookup.
+     */
+    void sortEntries()
+    {
+        std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b)
+                  { return before(a.id, a.name, b.id, b.name); });
+
+        lookup.clear();
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            lookup.emplace(entries[i].name, i);
+        }
+    }
+};
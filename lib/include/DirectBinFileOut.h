@@ -0,0 +1,292 @@
+#pragma once
+
+#include "FileOut.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <string>
+#include <format>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief Class for writing length-prefixed binary data with direct I/O.
+ *
+ * This class inherits from `FileOut` and writes the same format as `BinFileOut`
+ * (4-byte little-endian size followed by the data content). The file is opened with
+ * `O_DIRECT`, so written data bypasses the page cache and does not evict data other
+ * processes are reading. Records are collected in an aligned buffer and written out
+ * in whole aligned blocks. The last, partial block is written zero-padded and the
+ * file is truncated to its real size on `close()`.
+ *
+ * The file can be pre-allocated with `fallocate()` to reduce fragmentation. File systems
+ * without `O_DIRECT` support (e.g. tmpfs) fall back to regular buffered writes.
+ */
+class DirectBinFileOut : public FileOut<std::vector<uint8_t>>
+{
+public:
+    static constexpr size_t Alignment = 4096;                ///< Alignment of buffers, offsets and lengths.
+    static constexpr size_t DefaultBufferSize = 1024 * 1024; ///< Default size of the aligned buffer.
+
+private:
+    /**
+     * @brief Deleter for buffers obtained from `std::aligned_alloc`.
+     */
+    struct FreeDeleter
+    {
+        void operator()(uint8_t *pointer) const noexcept { std::free(pointer); }
+    };
+
+    std::unique_ptr<uint8_t, FreeDeleter> buffer; ///< Aligned staging buffer.
+    size_t capacity = 0;                          ///< Size of the allocated staging buffer.
+    size_t bufferSize = DefaultBufferSize;        ///< Requested size of the staging buffer.
+    size_t used = 0;                              ///< Number of bytes in the staging buffer.
+    uint64_t fileOffset = 0;                      ///< File offset of the staging buffer (always aligned).
+    uint64_t preallocateSize = 0;                 ///< Number of bytes reserved with fallocate() on open.
+    int fd = -1;                                  ///< Descriptor of the open file.
+    bool direct = false;                          ///< Flag indicating whether the file was opened with O_DIRECT.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The staging buffer size, rounded up to a multiple of `Alignment`.
+     */
+    explicit DirectBinFileOut(size_t size = DefaultBufferSize) { setBufferSize(size); }
+
+    /**
+     * @brief Destructor that writes out buffered records and closes the file.
+     */
+    ~DirectBinFileOut() { close(); }
+
+    /**
+     * @brief Sets the staging buffer size.
+     *
+     * Takes effect on the next `open()`.
+     *
+     * @param size The buffer size, rounded up to a multiple of `Alignment`.
+     */
+    void setBufferSize(size_t size)
+    {
+        size = std::max(size, Alignment);
+        bufferSize = (size + Alignment - 1) / Alignment * Alignment;
+    }
+
+    /**
+     * @brief Sets the number of bytes reserved for the file when it is opened.
+     *
+     * The blocks are reserved beyond the end of the file, its size only grows as records are written.
+     *
+     * @param size The number of bytes to pre-allocate, 0 disables pre-allocation.
+     */
+    void setPreallocateSize(uint64_t size) { preallocateSize = size; }
+
+    /**
+     * @brief Checks whether the open file bypasses the page cache.
+     *
+     * @return True if the file was opened with O_DIRECT.
+     */
+    bool isDirect() const { return direct; }
+
+    /**
+     * @brief Opens (and truncates) a binary file for direct writing.
+     *
+     * @param file The path to the binary file to open.
+     * @throws std::runtime_error If the file cannot be opened or the buffer cannot be allocated.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+
+        std::string fileName(file);
+        direct = true;
+        fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | O_DIRECT, 0644);
+        if (fd < 0 && errno == EINVAL)
+        {
+            direct = false;
+            fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        }
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        if (preallocateSize > 0)
+        {
+            // Reserves blocks without changing the visible size, so a crash before close() does not
+            // leave a zero-filled tail. Not every file system supports fallocate(), the file then
+            // simply grows as it is written
+            [[maybe_unused]] int allocated = ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(preallocateSize));
+        }
+
+        if (!buffer || capacity != bufferSize)
+        {
+            capacity = bufferSize;
+            buffer.reset(static_cast<uint8_t *>(std::aligned_alloc(Alignment, capacity)));
+            if (!buffer)
+            {
+                capacity = 0;
+                ::close(fd);
+                fd = -1;
+                throw std::runtime_error("Failed to allocate aligned buffer");
+            }
+        }
+        used = 0;
+        fileOffset = 0;
+    }
+
+    /**
+     * @brief Writes out the buffered records, truncates the file to its real size and closes it.
+     */
+    void close() noexcept override
+    {
+        if (fd < 0)
+        {
+            return;
+        }
+
+        uint64_t size = fileOffset + used;
+        try
+        {
+            writeTail();
+        }
+        catch (const std::exception &)
+        {
+            // close() cannot report errors, the file keeps what was written so far
+        }
+
+        // Removes the padding of the last block and any pre-allocated space. Should this fail,
+        // the zero padding reads back as the end of the stream.
+        [[maybe_unused]] int truncated = ::ftruncate(fd, static_cast<off_t>(size));
+        ::close(fd);
+        fd = -1;
+        used = 0;
+    }
+
+    /**
+     * @brief Writes binary data to the file.
+     *
+     * Writes the size of the data (4 bytes, little-endian) followed by the actual data content.
+     *
+     * @param data The vector of bytes to write to the file.
+     * @throws std::runtime_error If the file is not open for writing or writing fails.
+     */
+    void write(const std::vector<uint8_t> &data) override
+    {
+        if (fd < 0)
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+
+        // Write size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = static_cast<uint32_t>(data.size());
+        uint8_t header[sizeof(dataSize)];
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            header[i] = static_cast<uint8_t>(dataSize >> (i * 8));
+        }
+
+        append(header, sizeof(header));
+        append(data.data(), data.size());
+    }
+
+    /**
+     * @brief Writes out all buffered records.
+     *
+     * Whole blocks are written out and released from the buffer. The last, partial block is
+     * written zero-padded and kept in the buffer, it is rewritten once more records follow.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void flush() override
+    {
+        if (fd < 0)
+        {
+            return;
+        }
+
+        size_t aligned = used / Alignment * Alignment;
+        if (aligned > 0)
+        {
+            writeBlocks(aligned);
+        }
+        writeTail();
+    }
+
+private:
+    /**
+     * @brief Copies bytes into the staging buffer, writing it out whenever it is full.
+     */
+    void append(const uint8_t *data, size_t size)
+    {
+        while (size > 0)
+        {
+            size_t count = std::min(size, capacity - used);
+            std::memcpy(buffer.get() + used, data, count);
+            used += count;
+            data += count;
+            size -= count;
+
+            if (used == capacity)
+            {
+                writeBlocks(capacity);
+            }
+        }
+    }
+
+    /**
+     * @brief Writes the first `count` bytes (a multiple of `Alignment`) of the buffer and releases them.
+     */
+    void writeBlocks(size_t count)
+    {
+        writeAt(buffer.get(), count, fileOffset);
+        fileOffset += count;
+        used -= count;
+        if (used > 0)
+        {
+            std::memmove(buffer.get(), buffer.get() + count, used);
+        }
+    }
+
+    /**
+     * @brief Writes the partial block at the end of the buffer, padded with zeros to a whole block.
+     */
+    void writeTail()
+    {
+        if (used == 0)
+        {
+            return;
+        }
+        size_t padded = (used + Alignment - 1) / Alignment * Alignment;
+        std::memset(buffer.get() + used, 0, padded - used);
+        writeAt(buffer.get(), padded, fileOffset);
+    }
+
+    /**
+     * @brief Writes a buffer at the given offset, retrying short writes.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void writeAt(const uint8_t *data, size_t size, uint64_t offset)
+    {
+        while (size > 0)
+        {
+            ssize_t result = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error(std::format("Failed to write data block: {}", std::strerror(errno)));
+            }
+            data += result;
+            size -= static_cast<size_t>(result);
+            offset += static_cast<uint64_t>(result);
+        }
+    }
+};
@@ -2,12 +2,17 @@
 
 #include "File.h"
 #include <fstream>
+#include <optional>
 
 /**
  * @brief Abstract class for handling input file operations.
  * 
  * This class extends the `File` interface and provides a base for reading data from files.
  * Derived classes must implement the `read` function to define specific reading behavior.
+ *
+ * The end of the file is signalled by `tryRead()` returning no value. Handlers whose
+ * `read()` throws at the end of the file override `tryRead()`, so that callers reading a
+ * whole file never need an exception to stop.
  * 
  * @tparam O The type of data that will be read from the file.
  */
@@ -41,4 +46,26 @@ public:
      * @return The data read from the file.
      */
     virtual O read() = 0;
+
+    /**
+     * @brief Reads data from the input file, signalling the end of the file without exceptions.
+     *
+     * The default implementation calls `read()` and treats an empty record (as returned
+     * by the binary handlers at the end of the file) as the end.
+     *
+     * @return The data read from the file, or no value at the end of the file.
+     * @throws std::runtime_error If reading fails.
+     */
+    virtual std::optional<O> tryRead()
+    {
+        O record = read();
+        if constexpr (requires { record.empty(); })
+        {
+            if (record.empty())
+            {
+                return std::nullopt;
+            }
+        }
+        return record;
+    }
 };
\ No newline at end of file
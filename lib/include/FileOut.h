@@ -2,6 +2,7 @@
 
 #include "File.h"
 #include <fstream>
+#include <span>
 
 /**
  * @brief Abstract class for handling output file operations.
@@ -41,4 +42,35 @@ public:
      * @param data The data to be written to the file.
      */
     virtual void write(const O &data) = 0;
+
+    /**
+     * @brief Writes several records to the output file.
+     * 
+     * The default implementation writes the records one by one. Derived classes that stage
+     * records in a buffer override this function to append the whole batch in one pass and
+     * hand it to the stream in a single call.
+     * 
+     * @param records The records to write, in order.
+     */
+    virtual void writeBatch(std::span<const O> records)
+    {
+        for (const auto &record : records)
+        {
+            write(record);
+        }
+    }
+
+    /**
+     * @brief Flushes buffered data to the output file.
+     * 
+     * Derived classes that keep their own buffers must override this function
+     * to write them out before flushing the stream.
+     */
+    virtual void flush()
+    {
+        if (outFile.is_open())
+        {
+            outFile.flush();
+        }
+    }
 };
\ No newline at end of file
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Coroutine generator yielding a sequence of values.
+ *
+ * A function returning `Generator<T>` may `co_yield` values of type `T`. The body runs
+ * lazily: it starts on `begin()` and is resumed on every increment of the iterator, so each
+ * stage of a pipeline (decode, filter, accumulate) processes one value at a time without
+ * storing the sequence. The generator is a single-pass view and composes with the standard
+ * range adaptors. Exceptions thrown by the body are rethrown from `begin()` and the
+ * increment of the iterator.
+ *
+ * Pipelines are built from the stages `filter()` and `accumulate()`, which consume the
+ * generator they are called on and return the next stage, and are finished by `fold()`:
+ *
+ * @code
+ * double sum = reader.generate()
+ *                  .filter([](double value) { return value >= 0.0; })
+ *                  .fold(0.0, std::plus{});
+ * @endcode
+ *
+ * Several generators can be advanced in turn with `interleave()`, which lets one thread
+ * process the streams of a replication cooperatively.
+ *
+ * @tparam T The type of the yielded values.
+ */
+template <typename T>
+class Generator : public std::ranges::view_interface<Generator<T>>
+{
+public:
+    /**
+     * @brief Coroutine state of the generator.
+     */
+    struct promise_type
+    {
+        const T *current = nullptr;   ///< Last yielded value, alive while the coroutine is suspended.
+        std::exception_ptr exception; ///< Exception thrown by the body.
+
+        Generator get_return_object() { return Generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { exception = std::current_exception(); }
+
+        std::suspend_always yield_value(const T &value) noexcept
+        {
+            current = std::addressof(value);
+            return {};
+        }
+
+        /**
+         * @brief Forbids `co_await` in the body, generators only yield.
+         */
+        template <typename U>
+        std::suspend_never await_transform(U &&) = delete;
+    };
+
+    /**
+     * @brief Iterator resuming the coroutine on every increment.
+     */
+    class iterator
+    {
+    private:
+        std::coroutine_handle<promise_type> coroutine; ///< The coroutine of the generator.
+
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+
+        iterator() = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle) : coroutine(handle) {}
+
+        iterator(iterator &&) = default;
+        iterator &operator=(iterator &&) = default;
+
+        /**
+         * @brief Gets the last yielded value.
+         */
+        const T &operator*() const { return *coroutine.promise().current; }
+
+        /**
+         * @brief Resumes the coroutine until it yields the next value or finishes.
+         *
+         * @throws Any exception thrown by the body of the coroutine.
+         */
+        iterator &operator++()
+        {
+            resume(coroutine);
+            return *this;
+        }
+
+        /**
+         * @brief Resumes the coroutine until it yields the next value or finishes.
+         */
+        void operator++(int) { ++*this; }
+
+        /**
+         * @brief Checks whether the coroutine finished.
+         */
+        friend bool operator==(const iterator &it, std::default_sentinel_t) { return !it.coroutine || it.coroutine.done(); }
+    };
+
+private:
+    std::coroutine_handle<promise_type> coroutine; ///< The coroutine, owned by the generator.
+
+    explicit Generator(std::coroutine_handle<promise_type> handle) : coroutine(handle) {}
+
+public:
+    Generator() = default;
+
+    /**
+     * @brief Destructor that destroys the coroutine.
+     */
+    ~Generator()
+    {
+        if (coroutine)
+        {
+            coroutine.destroy();
+        }
+    }
+
+    Generator(const Generator &) = delete;
+    Generator &operator=(const Generator &) = delete;
+
+    Generator(Generator &&other) noexcept : coroutine(std::exchange(other.coroutine, {})) {}
+
+    Generator &operator=(Generator &&other) noexcept
+    {
+        if (this != &other)
+        {
+            if (coroutine)
+            {
+                coroutine.destroy();
+            }
+            coroutine = std::exchange(other.coroutine, {});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Starts the coroutine and returns an iterator to the first value.
+     *
+     * @throws Any exception thrown by the body of the coroutine.
+     */
+    iterator begin()
+    {
+        resume(coroutine);
+        return iterator(coroutine);
+    }
+
+    /**
+     * @brief Returns the sentinel marking the end of the values.
+     */
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+    /**
+     * @brief Filter stage yielding the values of this generator accepted by a predicate.
+     *
+     * @param predicate Called as `predicate(value)`, true keeps the value.
+     * @return The generator of the accepted values, it takes over this generator.
+     */
+    template <typename P>
+    Generator filter(P predicate) &&
+    {
+        return filterStage(std::move(*this), std::move(predicate));
+    }
+
+    /**
+     * @brief Accumulate stage yielding the running accumulation of the values of this generator.
+     *
+     * Every value updates the accumulator with `operation(accumulator, value)` and yields its
+     * new state, so the last yielded value is the result. Accumulate stages of several
+     * streams can be advanced in turn with `interleave()`.
+     *
+     * @param initial The initial state of the accumulator.
+     * @param operation Called as `operation(accumulator, value)`, returns the new state.
+     * @return The generator of the running accumulations, it takes over this generator.
+     */
+    template <typename A, typename Op>
+    Generator<A> accumulate(A initial, Op operation) &&
+    {
+        return accumulateStage(std::move(*this), std::move(initial), std::move(operation));
+    }
+
+    /**
+     * @brief Consumes the generator and folds its values into a result.
+     *
+     * @param initial The initial state of the accumulator.
+     * @param operation Called as `operation(accumulator, value)`, returns the new state.
+     * @return The final state of the accumulator.
+     * @throws Any exception thrown by the body of the coroutine.
+     */
+    template <typename A, typename Op>
+    A fold(A initial, Op operation) &&
+    {
+        Generator source = std::move(*this);
+        for (const T &value : source)
+        {
+            initial = operation(std::move(initial), value);
+        }
+        return initial;
+    }
+
+    /**
+     * @brief Advances several generators in turn, one value each, until all are finished.
+     *
+     * The values are passed to `consume` as they are produced, so only one value of every
+     * generator is alive at a time.
+     *
+     * @param generators The generators to advance.
+     * @param consume Called as `consume(index, value)` with the index of the generator.
+     * @throws Any exception thrown by a generator or by `consume`.
+     */
+    template <typename F>
+    static void interleave(std::vector<Generator> &generators, F &&consume)
+    {
+        std::vector<iterator> positions;
+        positions.reserve(generators.size());
+        for (auto &generator : generators)
+        {
+            positions.push_back(generator.begin());
+        }
+
+        bool active = true;
+        while (active)
+        {
+            active = false;
+            for (size_t i = 0; i < positions.size(); ++i)
+            {
+                if (positions[i] != std::default_sentinel)
+                {
+                    consume(i, *positions[i]);
+                    ++positions[i];
+                    active = true;
+                }
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Body of the filter stage, owns the source generator.
+     */
+    template <typename P>
+    static Generator filterStage(Generator source, P predicate)
+    {
+        for (const T &value : source)
+        {
+            if (predicate(value))
+            {
+                co_yield value;
+            }
+        }
+    }
+
+    /**
+     * @brief Body of the accumulate stage, owns the source generator.
+     */
+    template <typename A, typename Op>
+    static Generator<A> accumulateStage(Generator source, A accumulator, Op operation)
+    {
+        for (const T &value : source)
+        {
+            accumulator = operation(std::move(accumulator), value);
+            co_yield accumulator;
+        }
+    }
+
+    /**
+     * @brief Resumes a coroutine that has not finished and rethrows its exception.
+     */
+    static void resume(std::coroutine_handle<promise_type> handle)
+    {
+        if (!handle || handle.done())
+        {
+            return;
+        }
+        handle.resume();
+        if (handle.promise().exception)
+        {
+            std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+        }
+    }
+};
@@ -0,0 +1,292 @@
+#pragma once
+
+#include "BinConverter.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstring>
+#include <bit>
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Converts blocks of double values to and from a compressed binary format.
+ *
+ * Consecutive values are XOR-ed with their predecessor and only the meaningful bits
+ * of the result are stored, as in Facebook's Gorilla time series database. Repeated
+ * values take a single bit and slowly changing values typically a dozen or two.
+ *
+ * Format: [4 bytes count (uint32_t) | 8 bytes first value | bit stream of the remaining values]
+ *
+ * For every further value the bit stream holds:
+ * - `0` if it equals its predecessor,
+ * - `10` followed by the meaningful bits if they fit into the previous leading/trailing zero window,
+ * - `11` followed by 5 bits of leading zeros, 6 bits of meaningful bit count (64 stored as 0)
+ *   and the meaningful bits otherwise.
+ */
+class GorillaBinConverter : public BinConverter<std::vector<double>>
+{
+public:
+    /**
+     * @brief Compresses a block of double values.
+     *
+     * @param data The values to compress.
+     * @return A byte vector holding the compressed block.
+     */
+    std::vector<uint8_t> convert(const std::vector<double> &data) override
+    {
+        std::vector<uint8_t> buffer;
+        encode(std::span<const double>(data), buffer);
+        return buffer;
+    }
+
+    /**
+     * @brief Decompresses a block of double values.
+     *
+     * @param data A byte vector holding the compressed block.
+     * @return The decompressed values.
+     * @throws std::runtime_error If the block is truncated.
+     */
+    std::vector<double> convert(const std::vector<uint8_t> &data) override
+    {
+        std::vector<double> values;
+        decode(std::span<const uint8_t>(data), values);
+        return values;
+    }
+
+    /**
+     * @brief Decompresses a view of a block of double values.
+     *
+     * @param data A view of the compressed block.
+     * @return The decompressed values.
+     * @throws std::runtime_error If the block is truncated.
+     */
+    std::vector<double> convert(std::span<const uint8_t> data)
+    {
+        std::vector<double> values;
+        decode(data, values);
+        return values;
+    }
+
+    /**
+     * @brief Compresses a block of double values and appends it to a buffer.
+     *
+     * @param data The values to compress.
+     * @param out The buffer the compressed block is appended to.
+     */
+    static void encode(std::span<const double> data, std::vector<uint8_t> &out)
+    {
+        uint32_t count = static_cast<uint32_t>(data.size());
+        for (size_t i = 0; i < sizeof(count); ++i)
+        {
+            out.push_back(static_cast<uint8_t>(count >> (i * 8)));
+        }
+        if (data.empty())
+        {
+            return;
+        }
+
+        uint64_t previous = std::bit_cast<uint64_t>(data[0]);
+        for (size_t i = 0; i < sizeof(previous); ++i)
+        {
+            out.push_back(static_cast<uint8_t>(previous >> (i * 8)));
+        }
+
+        BitWriter bits(out);
+        int previousLeading = -1;
+        int previousTrailing = 0;
+        for (size_t i = 1; i < data.size(); ++i)
+        {
+            uint64_t current = std::bit_cast<uint64_t>(data[i]);
+            uint64_t xored = current ^ previous;
+            previous = current;
+
+            if (xored == 0)
+            {
+                bits.write(0, 1);
+                continue;
+            }
+
+            int leading = std::min(std::countl_zero(xored), 31);
+            int trailing = std::countr_zero(xored);
+            if (previousLeading >= 0 && leading >= previousLeading && trailing >= previousTrailing)
+            {
+                // Meaningful bits fit into the previous window
+                bits.write(0b10, 2);
+                bits.write(xored >> previousTrailing, 64 - previousLeading - previousTrailing);
+            }
+            else
+            {
+                int meaningful = 64 - leading - trailing;
+                bits.write(0b11, 2);
+                bits.write(static_cast<uint64_t>(leading), 5);
+                bits.write(static_cast<uint64_t>(meaningful & 63), 6);
+                bits.write(xored >> trailing, meaningful);
+                previousLeading = leading;
+                previousTrailing = trailing;
+            }
+        }
+        bits.finish();
+    }
+
+    /**
+     * @brief Decompresses a block of double values and appends them to a buffer.
+     *
+     * Decoding a stream block by block into one vector keeps all values contiguous.
+     *
+     * @param data A view of the compressed block.
+     * @param out The vector the values are appended to.
+     * @throws std::runtime_error If the block is truncated or its count exceeds the data.
+     */
+    static void decode(std::span<const uint8_t> data, std::vector<double> &out)
+    {
+        if (data.size() < sizeof(uint32_t))
+        {
+            throw std::runtime_error("Invalid data size for compressed block");
+        }
+
+        uint32_t count = 0;
+        for (size_t i = 0; i < sizeof(count); ++i)
+        {
+            count |= static_cast<uint32_t>(data[i]) << (i * 8);
+        }
+        if (count == 0)
+        {
+            return;
+        }
+        if (data.size() < sizeof(uint32_t) + sizeof(uint64_t))
+        {
+            throw std::runtime_error("Invalid data size for compressed block");
+        }
+
+        uint64_t previous = 0;
+        for (size_t i = 0; i < sizeof(previous); ++i)
+        {
+            previous |= static_cast<uint64_t>(data[sizeof(uint32_t) + i]) << (i * 8);
+        }
+
+        // Every value after the first takes at least one bit, reject a count the data cannot hold
+        size_t payloadBits = (data.size() - sizeof(uint32_t) - sizeof(uint64_t)) * 8;
+        if (count - 1 > payloadBits)
+        {
+            throw std::runtime_error("Truncated compressed block");
+        }
+
+        size_t start = out.size();
+        out.resize(start + count);
+        double *values = out.data() + start;
+        values[0] = std::bit_cast<double>(previous);
+
+        BitReader bits(data.subspan(sizeof(uint32_t) + sizeof(uint64_t)));
+        int leading = 0;
+        int trailing = 0;
+        for (uint32_t i = 1; i < count; ++i)
+        {
+            if (bits.read(1) != 0)
+            {
+                if (bits.read(1) != 0)
+                {
+                    leading = static_cast<int>(bits.read(5));
+                    int meaningful = static_cast<int>(bits.read(6));
+                    meaningful = meaningful == 0 ? 64 : meaningful;
+                    trailing = 64 - leading - meaningful;
+                    if (trailing < 0)
+                    {
+                        throw std::runtime_error("Corrupted compressed block");
+                    }
+                }
+                previous ^= bits.read(64 - leading - trailing) << trailing;
+            }
+            values[i] = std::bit_cast<double>(previous);
+        }
+    }
+
+private:
+    /**
+     * @brief Appends bits to a byte buffer, most significant bit first.
+     */
+    class BitWriter
+    {
+    private:
+        std::vector<uint8_t> &out; ///< Buffer receiving the bytes.
+        uint64_t pending = 0;      ///< Bits not yet written out.
+        int pendingCount = 0;      ///< Number of bits in `pending`.
+
+    public:
+        explicit BitWriter(std::vector<uint8_t> &buffer) : out(buffer) {}
+
+        /**
+         * @brief Writes the lowest `count` bits of `value`.
+         */
+        void write(uint64_t value, int count)
+        {
+            while (count > 0)
+            {
+                int chunk = std::min(count, 56 - pendingCount);
+                uint64_t bits = (value >> (count - chunk)) & ((uint64_t{1} << chunk) - 1);
+                pending = (pending << chunk) | bits;
+                pendingCount += chunk;
+                count -= chunk;
+                while (pendingCount >= 8)
+                {
+                    pendingCount -= 8;
+                    out.push_back(static_cast<uint8_t>(pending >> pendingCount));
+                }
+            }
+        }
+
+        /**
+         * @brief Writes out the remaining bits, padded with zeros to a whole byte.
+         */
+        void finish()
+        {
+            if (pendingCount > 0)
+            {
+                out.push_back(static_cast<uint8_t>(pending << (8 - pendingCount)));
+                pendingCount = 0;
+            }
+        }
+    };
+
+    /**
+     * @brief Reads bits from a byte buffer, most significant bit first.
+     */
+    class BitReader
+    {
+    private:
+        std::span<const uint8_t> data; ///< Bytes being read.
+        size_t position = 0;           ///< Index of the next byte to load.
+        uint64_t pending = 0;          ///< Loaded bits not yet consumed.
+        int pendingCount = 0;          ///< Number of bits in `pending`.
+
+    public:
+        explicit BitReader(std::span<const uint8_t> bytes) : data(bytes) {}
+
+        /**
+         * @brief Reads `count` bits (up to 64).
+         *
+         * @throws std::runtime_error If the data ends first.
+         */
+        uint64_t read(int count)
+        {
+            uint64_t result = 0;
+            while (count > 0)
+            {
+                if (pendingCount == 0)
+                {
+                    if (position >= data.size())
+                    {
+                        throw std::runtime_error("Truncated compressed block");
+                    }
+                    pending = data[position++];
+                    pendingCount = 8;
+                }
+                int chunk = std::min(count, pendingCount);
+                pendingCount -= chunk;
+                result = (result << chunk) | ((pending >> pendingCount) & ((uint64_t{1} << chunk) - 1));
+                count -= chunk;
+            }
+            return result;
+        }
+    };
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "FileIn.h"
+#include "GorillaBinConverter.h"
+#include "BinFileIn.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Class for reading double values stored as compressed blocks by `GorillaFileOut`.
+ *
+ * The block file handler `F` returns one compressed block per read, which is decoded into
+ * a reusable vector. Each `read()` returns a view of the next raw 8-byte value for
+ * `ColumnConverter`, so no allocation per value takes place. A returned view stays valid
+ * until the next read. Bulk consumers decode whole blocks with `readBlock()` instead.
+ *
+ * @tparam F The file handling class returning one compressed block per read (e.g. `BinFileIn` or `MappedBinFileIn`).
+ */
+template <typename F = BinFileIn>
+class GorillaFileIn : public FileIn<std::span<const uint8_t>>
+{
+private:
+    F blockFile;                ///< File handler reading the compressed blocks.
+    std::vector<double> values; ///< Values of the current block.
+    size_t position = 0;        ///< Index of the next value in `values`.
+
+public:
+    /**
+     * @brief Gets the file handler reading the compressed blocks.
+     *
+     * @return A reference to the block file handler.
+     */
+    F &getBlockFile() { return blockFile; }
+
+    /**
+     * @brief Opens a file for reading.
+     *
+     * @param file The path to the file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(std::string_view file) override
+    {
+        close();
+        blockFile.open(file);
+    }
+
+    /**
+     * @brief Closes the currently open file.
+     */
+    void close() noexcept override
+    {
+        blockFile.close();
+        values.clear();
+        position = 0;
+    }
+
+    /**
+     * @brief Reads the next value.
+     *
+     * @return A view of the raw 8-byte value, or an empty view at the end of the file.
+     * @throws std::runtime_error If reading or decoding a block fails.
+     */
+    std::span<const uint8_t> read() override
+    {
+        while (position >= values.size())
+        {
+            if (!nextBlock())
+            {
+                return {};
+            }
+        }
+        return std::span<const uint8_t>(reinterpret_cast<const uint8_t *>(&values[position++]), sizeof(double));
+    }
+
+    /**
+     * @brief Decodes the next compressed block and appends its values to a vector.
+     *
+     * The block is decoded straight into the vector, without a copy per value. Values of a
+     * block partly consumed by `read()` are appended first.
+     *
+     * @param out The vector the values are appended to.
+     * @return The number of appended values, 0 at the end of the file.
+     * @throws std::runtime_error If reading or decoding the block fails.
+     */
+    size_t readBlock(std::vector<double> &out)
+    {
+        if (position < values.size())
+        {
+            out.insert(out.end(), values.begin() + static_cast<std::ptrdiff_t>(position), values.end());
+            size_t count = values.size() - position;
+            values.clear();
+            position = 0;
+            return count;
+        }
+
+        auto block = blockFile.read();
+        if (block.empty())
+        {
+            return 0;
+        }
+        size_t start = out.size();
+        GorillaBinConverter::decode(std::span<const uint8_t>(block.data(), block.size()), out);
+        return out.size() - start;
+    }
+
+private:
+    /**
+     * @brief Reads and decodes the next compressed block.
+     *
+     * @return False at the end of the file.
+     */
+    bool nextBlock()
+    {
+        values.clear();
+        position = 0;
+
+        auto block = blockFile.read();
+        if (block.empty())
+        {
+            return false;
+        }
+        GorillaBinConverter::decode(std::span<const uint8_t>(block.data(), block.size()), values);
+        return true;
+    }
+};
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "FileOut.h"
+#include "GorillaBinConverter.h"
+#include "BinFileOut.h"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <iostream>
+
+/**
+ * @brief Class for writing double values as compressed blocks.
+ *
+ * This class inherits from `FileOut` and receives the raw 8-byte values produced by
+ * `ColumnConverter`. Values are collected into blocks of a fixed size, each block is
+ * compressed with `GorillaBinConverter` and written as one record by the block file
+ * handler `F`. An incomplete block is written on `flush()` and `close()`.
+ *
+ * @tparam F The file handling class writing the compressed blocks as byte vectors (e.g. `BinFileOut`).
+ */
+template <typename F = BinFileOut>
+class GorillaFileOut : public FileOut<std::vector<uint8_t>>
+{
+public:
+    static constexpr size_t DefaultBlockSize = 4096; ///< Default number of values per block.
+
+private:
+    F blockFile;                  ///< File handler writing the compressed blocks.
+    std::vector<double> values;   ///< Values of the block being collected.
+    std::vector<uint8_t> encoded; ///< Reusable buffer for the compressed block.
+    size_t blockSize;             ///< Number of values per block.
+    bool opened = false;          ///< Flag indicating whether a file is currently open.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of values per block.
+     */
+    explicit GorillaFileOut(size_t size = DefaultBlockSize) : blockSize(size > 0 ? size : DefaultBlockSize) {}
+
+    /**
+     * @brief Destructor that writes out the incomplete block and closes the file.
+     */
+    ~GorillaFileOut() { close(); }
+
+    /**
+     * @brief Sets the number of values per block.
+     *
+     * Takes effect with the next block.
+     *
+     * @param size The number of values per block, 0 restores the default.
+     */
+    void setBlockSize(size_t size) { blockSize = size > 0 ? size : DefaultBlockSize; }
+
+    /**
+     * @brief Gets the number of values per block.
+     *
+     * @return The number of values per block.
+     */
+    size_t getBlockSize() const { return blockSize; }
+
+    /**
+     * @brief Gets the file handler writing the compressed blocks.
+     *
+     * Allows configuring it (e.g. its buffer size) before writing.
+     *
+     * @return A reference to the block file handler.
+     */
+    F &getBlockFile() { return blockFile; }
+
+    /**
+     * @brief Opens (and truncates) a file for writing.
+     *
+     * @param file The path to the file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+        blockFile.open(file);
+        opened = true;
+        values.reserve(blockSize);
+    }
+
+    /**
+     * @brief Writes out the incomplete block and closes the file.
+     */
+    void close() noexcept override
+    {
+        if (!opened)
+        {
+            return;
+        }
+
+        try
+        {
+            writeBlock();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: " << e.what() << std::endl;
+        }
+        values.clear();
+        blockFile.close();
+        opened = false;
+    }
+
+    /**
+     * @brief Adds a value to the current block.
+     *
+     * The block is compressed and written once it is full.
+     *
+     * @param data The raw 8-byte value produced by `ColumnConverter`.
+     * @throws std::runtime_error If the file is not open, the value has an invalid size or writing fails.
+     */
+    void write(const std::vector<uint8_t> &data) override
+    {
+        if (!opened)
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+        if (data.size() != sizeof(double))
+        {
+            throw std::runtime_error("Invalid data size for compressed value");
+        }
+
+        double value;
+        std::memcpy(&value, data.data(), sizeof(value));
+        values.push_back(value);
+        if (values.size() >= blockSize)
+        {
+            writeBlock();
+        }
+    }
+
+    /**
+     * @brief Writes out the incomplete block and flushes the block file handler.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void flush() override
+    {
+        if (opened)
+        {
+            writeBlock();
+            blockFile.flush();
+        }
+    }
+
+private:
+    /**
+     * @brief Compresses the collected values and writes them as one block.
+     */
+    void writeBlock()
+    {
+        if (values.empty())
+        {
+            return;
+        }
+        encoded.clear();
+        GorillaBinConverter::encode(values, encoded);
+        blockFile.write(encoded);
+        values.clear();
+    }
+};
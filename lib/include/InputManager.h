@@ -1,11 +1,14 @@
 #pragma once
 
 #include "Replication.h"
+#include "ArchiveIndex.h"
+#include "DatasetManifest.h"
 #include <vector>
 #include <filesystem>
 #include <memory>
 #include <iostream>
 #include <algorithm>
+#include <optional>
 #include <format>
 
 /**
@@ -15,6 +18,12 @@
  * methods to load replications from a specified base path or from a specific replication directory. 
  * It also supports batch loading and sorting of the replications based on their names.
  * 
+ * Replications stored in containers may also be packed in an archive (see `ArchiveIndex`).
+ * If the base path holds an archive index, replications are listed and located through it
+ * instead of the directory tree. Otherwise a current manifest written by `OutputManager`
+ * (see `DatasetManifest`) lists them in sorted order; the folder is only scanned when the
+ * manifest is missing or stale.
+ * 
  * @tparam R The replication type, which must inherit from Replication.
  */
 template <ReplicationType R>
@@ -26,6 +35,10 @@ public:
 private:
     std::vector<std::shared_ptr<R>> replications; ///< List of loaded replications.
     std::string basePath;                          ///< Base path where replication data is located.
+    std::optional<ArchiveIndex> archive;           ///< Archive index of the base path, if read.
+    bool archiveChecked = false;                   ///< Flag indicating whether the archive index was looked up.
+    std::optional<DatasetManifest> manifest;       ///< Manifest of the base path, if read and current.
+    bool manifestChecked = false;                  ///< Flag indicating whether the manifest was looked up.
 
 public:
     /**
@@ -74,30 +87,70 @@ public:
         if (!basePath.empty() && basePath.back() != '/') {
             basePath = std::format("{}/", basePath);
         }
+        archive.reset();
+        archiveChecked = false;
+        manifest.reset();
+        manifestChecked = false;
     }
 
     /**
-     * @brief Loads all replications from the base path.
+     * @brief Gets the manifest of the base path.
      * 
-     * Iterates over the directories in the base path and initializes the corresponding replications.
+     * The manifest is read on first use. It gives the replication names in sorted order and
+     * the record counts and sizes of their streams without opening any file.
+     * 
+     * @return The manifest, or nullptr if the base path has no current manifest.
      */
-    void loadReplications()
+    const DatasetManifest *getManifest()
     {
-        int c = 1;
-        for (const auto &entry : std::filesystem::directory_iterator(basePath))
+        if (!manifestChecked)
+        {
+            manifestChecked = true;
+            DatasetManifest index;
+            if (DatasetManifest::isCurrent(basePath) && index.load(DatasetManifest::pathFor(basePath)))
+            {
+                manifest = std::move(index);
+            }
+        }
+        return manifest ? &*manifest : nullptr;
+    }
+
+    /**
+     * @brief Counts the replications in the base path without loading them.
+     * 
+     * @return The number of replications.
+     */
+    size_t countReplications()
+    {
+        if (getArchive() == nullptr)
         {
-            if (entry.is_directory())
+            if (const DatasetManifest *index = getManifest())
             {
-                std::string folderName = entry.path().filename().string();
-                c++;
-                auto replication = std::make_shared<R>(folderName);
-                replication->setBasePath(basePath + folderName + "/");
-                replication->setName(folderName);
-                replication->init();
-                replications.push_back(replication);
+                return index->size();
             }
         }
-        sortReplications();
+        bool sorted;
+        return listReplicationNames(sorted).size();
+    }
+
+    /**
+     * @brief Loads all replications from the base path.
+     * 
+     * Iterates over the directories in the base path (or the entries of its archive index)
+     * and initializes the corresponding replications.
+     */
+    void loadReplications()
+    {
+        bool wasEmpty = replications.empty();
+        bool sorted;
+        for (const auto &name : listReplicationNames(sorted))
+        {
+            replications.push_back(createReplication(name));
+        }
+        if (!(sorted && wasEmpty))
+        {
+            sortReplications();
+        }
     }
 
     /**
@@ -109,16 +162,23 @@ public:
     void loadSpecificReplication(std::string_view name)
     {
         std::string fullPath = std::format("{}{}", basePath, name);
-        if (!std::filesystem::exists(fullPath) || !std::filesystem::is_directory(fullPath))
+        const DatasetManifest *listing = getManifest();
+        bool listed = listing && listing->find(name);
+        if constexpr (ContainerReplicationType<R>)
+        {
+            fullPath += R::ContainerExtension;
+            const ArchiveIndex *index = getArchive();
+            if (!listed && !(index && index->find(name)) && !std::filesystem::is_regular_file(fullPath))
+            {
+                throw std::runtime_error(std::format("File not found: {}", fullPath));
+            }
+        }
+        else if (!listed && (!std::filesystem::exists(fullPath) || !std::filesystem::is_directory(fullPath)))
         {
             throw std::runtime_error(std::format("Directory not found: {}", fullPath));
         }
 
-        auto replication = std::make_shared<R>(name.data());
-        replication->setBasePath(fullPath + "/");
-        replication->setName(name);
-        replication->init();
-        replications.push_back(replication);
+        replications.push_back(createReplication(std::string(name)));
     }
 
     /**
@@ -136,33 +196,25 @@ public:
         }
 
         int count = 0;
-        for (const auto &entry : std::filesystem::directory_iterator(basePath))
+        bool sorted;
+        for (const auto &folderName : listReplicationNames(sorted))
         {
-            if (entry.is_directory())
+            // Extract number from folder name
+            size_t numStart = folderName.find_last_not_of("0123456789") + 1;
+            try
             {
-                std::string folderName = entry.path().filename().string();
-
-                // Extract number from folder name
-                size_t numStart = folderName.find_last_not_of("0123456789") + 1;
-                try
+                int num = std::stoi(folderName.substr(numStart));
+                if (num >= start && num <= end)
                 {
-                    int num = std::stoi(folderName.substr(numStart));
-                    if (num >= start && num <= end)
-                    {
-                        auto replication = std::make_shared<R>(folderName);
-                        replication->setBasePath(basePath + folderName + "/");
-                        replication->setName(folderName);
-                        replication->init();
-                        replications.push_back(replication);
-                        count++;
-                    }
-                }
-                catch (...)
-                {
-                    // Skip folders that don’t have a number at the end
-                    throw std::runtime_error("Failed processing file: " + folderName);
+                    replications.push_back(createReplication(folderName));
+                    count++;
                 }
             }
+            catch (...)
+            {
+                // Skip folders that don’t have a number at the end
+                throw std::runtime_error("Failed processing file: " + folderName);
+            }
         }
     }
 
@@ -183,13 +235,13 @@ public:
      * @brief Sorts the loaded replications based on their names.
      * 
      * The sorting is based on the numerical part of the folder name. If no number is found, 
-     * it falls back to lexicographical sorting.
+     * it falls back to lexicographical sorting, as the manifest entries are (see `DatasetManifest::before()`).
      */
     void sortReplications() {
         // Pomocná štruktúra na uloženie čísla a replikácie
         struct SortableReplication {
             std::shared_ptr<R> replication;
-            int number = -1; // -1 pre replikácie bez čísla
+            int64_t number = DatasetManifest::NoId; // NoId pre replikácie bez čísla
             std::string name;
         };
     
@@ -198,22 +250,12 @@ public:
     
         for (const auto &rep : replications) {
             std::string name = rep->getName();
-            int num = -1;
-            size_t numStart = name.find_last_not_of("0123456789") + 1;
-            try {
-                num = std::stoi(name.substr(numStart));
-            } catch (...) {
-                // Bez čísla, použije sa name
-            }
-            sortable.push_back({rep, num, name});
+            sortable.push_back({rep, DatasetManifest::idFromName(name), name});
         }
     
         std::sort(sortable.begin(), sortable.end(),
                   [](const SortableReplication &a, const SortableReplication &b) {
-                      if (a.number != -1 && b.number != -1) {
-                          return a.number < b.number;
-                      }
-                      return a.name < b.name;
+                      return DatasetManifest::before(a.number, a.name, b.number, b.name);
                   });
     
         // Preusporiadať replikácie
@@ -265,6 +307,136 @@ public:
     {
         replications.clear();
     }
+
+private:
+    /**
+     * @brief Gets the archive index of the base path.
+     * 
+     * The index is read on first use.
+     * 
+     * @return The archive index, or nullptr if the base path holds no archive.
+     */
+    const ArchiveIndex *getArchive()
+    {
+        if constexpr (ContainerReplicationType<R>)
+        {
+            if (!archiveChecked)
+            {
+                archiveChecked = true;
+                ArchiveIndex index;
+                if (index.load(ArchiveIndex::pathFor(basePath)))
+                {
+                    archive = std::move(index);
+                }
+            }
+        }
+        return archive ? &*archive : nullptr;
+    }
+
+    /**
+     * @brief Lists the names of the replications in the base path.
+     * 
+     * @param sorted Set to true if the names are already in the order of `sortReplications()`.
+     * @return The names from the archive index if there is one, otherwise from the manifest
+     *         or the directory tree.
+     */
+    std::vector<std::string> listReplicationNames(bool &sorted)
+    {
+        std::vector<std::string> names;
+        sorted = false;
+        if (const ArchiveIndex *index = getArchive())
+        {
+            for (const auto &entry : index->getEntries())
+            {
+                // Skip entries superseded by a later one with the same name
+                if (index->find(entry.name) == &entry)
+                {
+                    names.push_back(entry.name);
+                }
+            }
+            return names;
+        }
+
+        if (const DatasetManifest *index = getManifest())
+        {
+            names.reserve(index->size());
+            for (const auto &entry : index->getEntries())
+            {
+                names.push_back(entry.name);
+            }
+            sorted = true;
+            return names;
+        }
+
+        for (const auto &entry : std::filesystem::directory_iterator(basePath))
+        {
+            if (isReplicationEntry(entry))
+            {
+                names.push_back(replicationName(entry));
+            }
+        }
+        return names;
+    }
+
+    /**
+     * @brief Checks whether a directory entry holds a replication.
+     * 
+     * Replications are directories, or files with the container extension for
+     * replications stored in a single file.
+     */
+    static bool isReplicationEntry(const std::filesystem::directory_entry &entry)
+    {
+        if constexpr (ContainerReplicationType<R>)
+        {
+            return entry.is_regular_file() && entry.path().extension() == R::ContainerExtension;
+        }
+        else
+        {
+            return entry.is_directory();
+        }
+    }
+
+    /**
+     * @brief Gets the name of the replication held by a directory entry.
+     */
+    static std::string replicationName(const std::filesystem::directory_entry &entry)
+    {
+        if constexpr (ContainerReplicationType<R>)
+        {
+            return entry.path().stem().string();
+        }
+        else
+        {
+            return entry.path().filename().string();
+        }
+    }
+
+    /**
+     * @brief Creates and initializes a replication.
+     * 
+     * @param name The name of the replication.
+     * @return A shared pointer to the initialized replication.
+     */
+    std::shared_ptr<R> createReplication(const std::string &name)
+    {
+        auto replication = std::make_shared<R>(name);
+        if constexpr (ContainerReplicationType<R>)
+        {
+            replication->setBasePath(basePath);
+            const ArchiveIndex *index = getArchive();
+            if (const ArchiveIndex::Entry *entry = index ? index->find(name) : nullptr)
+            {
+                replication->setContainerLocation(ArchiveIndex::segmentPath(basePath, entry->segment), entry->offset, entry->size);
+            }
+        }
+        else
+        {
+            replication->setBasePath(basePath + name + "/");
+        }
+        replication->setName(name);
+        replication->init();
+        return replication;
+    }
 };
 
 /**
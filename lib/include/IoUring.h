@@ -0,0 +1,369 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+#include <format>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @brief State of a single asynchronous read or write.
+ *
+ * The request must stay alive (and must not move) until it is done.
+ */
+struct IoRequest
+{
+    int result = 0;    ///< Number of bytes transferred, or a negative errno value.
+    bool done = true;  ///< Flag indicating whether the request has completed.
+};
+
+/**
+ * @brief Minimal wrapper around a Linux io_uring instance.
+ *
+ * Submits reads and writes to the kernel and reaps their completions. The rings are
+ * set up directly through the io_uring system calls, so no additional library is needed.
+ * When io_uring is not available (old kernel, disabled by the administrator or blocked
+ * by a seccomp filter) or does not support `IORING_OP_READ`/`IORING_OP_WRITE` (kernels
+ * before 5.6, detected by probing the opcodes once), every request is carried out
+ * immediately with blocking `pread()`/`pwrite()` calls instead, so callers never need a
+ * separate code path.
+ *
+ * `read()` and `write()` only queue a request; queued requests are handed to the kernel
+ * together by `submit()` or `wait()`, one system call for the whole batch. At most as many
+ * requests as the completion queue holds are in flight, further requests first wait for
+ * completions.
+ *
+ * An instance is not thread-safe. `local()` returns an instance shared by all files
+ * used by the calling thread, which keeps their requests in flight together.
+ */
+class IoUring
+{
+public:
+    static constexpr unsigned DefaultEntries = 256; ///< Default size of the submission queue.
+
+private:
+    int ringFd = -1;                 ///< File descriptor of the ring, -1 in blocking mode.
+    void *sqRing = nullptr;          ///< Mapped submission queue ring.
+    void *cqRing = nullptr;          ///< Mapped completion queue ring.
+    io_uring_sqe *sqes = nullptr;    ///< Mapped submission queue entries.
+    size_t sqRingSize = 0;           ///< Size of the submission queue mapping.
+    size_t cqRingSize = 0;           ///< Size of the completion queue mapping.
+    size_t sqesSize = 0;             ///< Size of the submission queue entries mapping.
+    unsigned *sqTail = nullptr;      ///< Submission queue tail (written by us).
+    unsigned *sqArray = nullptr;     ///< Submission queue index array.
+    unsigned sqMask = 0;             ///< Submission queue index mask.
+    unsigned *cqHead = nullptr;      ///< Completion queue head (written by us).
+    unsigned *cqTail = nullptr;      ///< Completion queue tail (written by the kernel).
+    unsigned cqMask = 0;             ///< Completion queue index mask.
+    io_uring_cqe *cqes = nullptr;    ///< Completion queue entries.
+    unsigned sqEntries = 0;          ///< Number of submission queue entries.
+    unsigned cqEntries = 0;          ///< Number of completion queue entries.
+    unsigned pending = 0;            ///< Number of queued requests not yet passed to the kernel.
+    unsigned inFlight = 0;           ///< Number of requests passed to the kernel and not yet reaped.
+
+public:
+    /**
+     * @brief Sets up a ring with the given number of submission queue entries.
+     *
+     * Falls back to blocking mode if the ring cannot be created or does not support
+     * reads and writes.
+     *
+     * @param entries The size of the submission queue.
+     */
+    explicit IoUring(unsigned entries = DefaultEntries)
+    {
+        io_uring_params params{};
+        int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0)
+        {
+            return;
+        }
+
+        ringFd = fd;
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMmap)
+        {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+
+        sqRing = ::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        cqRing = singleMmap ? sqRing
+                            : ::mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void *entriesMapping = ::mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || entriesMapping == MAP_FAILED)
+        {
+            if (entriesMapping != MAP_FAILED)
+            {
+                ::munmap(entriesMapping, sqesSize);
+            }
+            sqes = nullptr;
+            release();
+            return;
+        }
+        sqes = static_cast<io_uring_sqe *>(entriesMapping);
+
+        auto *sq = static_cast<uint8_t *>(sqRing);
+        sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+        sqArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+        sqMask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+
+        auto *cq = static_cast<uint8_t *>(cqRing);
+        cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        sqEntries = params.sq_entries;
+        cqEntries = params.cq_entries;
+
+        if (!supportsReadWrite())
+        {
+            release();
+        }
+    }
+
+    /**
+     * @brief Destructor that releases the ring.
+     */
+    ~IoUring() { release(); }
+
+    IoUring(const IoUring &) = delete;
+    IoUring &operator=(const IoUring &) = delete;
+
+    /**
+     * @brief Returns the ring shared by all files used by the calling thread.
+     *
+     * @return A reference to the thread-local ring.
+     */
+    static IoUring &local()
+    {
+        thread_local IoUring ring;
+        return ring;
+    }
+
+    /**
+     * @brief Checks whether requests are carried out asynchronously.
+     *
+     * @return True if the ring was set up, false in blocking mode.
+     */
+    bool available() const { return ringFd >= 0; }
+
+    /**
+     * @brief Starts reading from a file.
+     *
+     * @param fd The file descriptor to read from.
+     * @param buffer The destination buffer, it must stay alive until the request is done.
+     * @param length The number of bytes to read.
+     * @param offset The file offset to read from.
+     * @param request The request state, it must stay alive until the request is done.
+     */
+    void read(int fd, void *buffer, unsigned length, uint64_t offset, IoRequest &request)
+    {
+        if (!available())
+        {
+            request.result = static_cast<int>(::pread(fd, buffer, length, static_cast<off_t>(offset)));
+            request.result = request.result < 0 ? -errno : request.result;
+            request.done = true;
+            return;
+        }
+        queue(IORING_OP_READ, fd, buffer, length, offset, request);
+    }
+
+    /**
+     * @brief Starts writing to a file.
+     *
+     * @param fd The file descriptor to write to.
+     * @param buffer The source buffer, it must stay alive and unchanged until the request is done.
+     * @param length The number of bytes to write.
+     * @param offset The file offset to write to.
+     * @param request The request state, it must stay alive until the request is done.
+     */
+    void write(int fd, const void *buffer, unsigned length, uint64_t offset, IoRequest &request)
+    {
+        if (!available())
+        {
+            request.result = static_cast<int>(::pwrite(fd, buffer, length, static_cast<off_t>(offset)));
+            request.result = request.result < 0 ? -errno : request.result;
+            request.done = true;
+            return;
+        }
+        queue(IORING_OP_WRITE, fd, const_cast<void *>(buffer), length, offset, request);
+    }
+
+    /**
+     * @brief Passes the queued requests to the kernel in one system call.
+     *
+     * @throws std::runtime_error If the submission fails.
+     */
+    void submit()
+    {
+        while (pending > 0)
+        {
+            unsigned submitted = enter(pending, 0, 0);
+            if (submitted == 0)
+            {
+                throw std::runtime_error("io_uring_enter submitted no requests");
+            }
+            pending -= std::min(submitted, pending);
+            inFlight += submitted;
+        }
+    }
+
+    /**
+     * @brief Blocks until the given request is done.
+     *
+     * Queued requests are submitted first. Completions of other requests reaped in the
+     * meantime are recorded in their states.
+     *
+     * @param request The request to wait for.
+     * @throws std::runtime_error If submitting or waiting for completions fails.
+     */
+    void wait(IoRequest &request)
+    {
+        submit();
+        while (!request.done)
+        {
+            reap();
+            if (request.done)
+            {
+                break;
+            }
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+        }
+    }
+
+private:
+    /**
+     * @brief Checks that the kernel supports the read and write opcodes.
+     *
+     * Kernels before 5.6 set up rings but complete `IORING_OP_READ`/`IORING_OP_WRITE`
+     * with `-EINVAL`; they also lack `IORING_REGISTER_PROBE`, so a failed probe means the
+     * opcodes are unavailable.
+     */
+    bool supportsReadWrite() noexcept
+    {
+        constexpr unsigned probeOps = 256;
+        std::vector<uint8_t> storage(sizeof(io_uring_probe) + probeOps * sizeof(io_uring_probe_op));
+        auto *probe = reinterpret_cast<io_uring_probe *>(storage.data());
+        if (::syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, probeOps) < 0)
+        {
+            return false;
+        }
+
+        auto supported = [probe](unsigned opcode)
+        {
+            return opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+        };
+        return supported(IORING_OP_READ) && supported(IORING_OP_WRITE);
+    }
+
+    /**
+     * @brief Puts a request into the submission queue.
+     *
+     * Waits for completions while the completion queue could overflow, and submits the
+     * queued requests while the submission queue is full.
+     */
+    void queue(uint8_t opcode, int fd, void *buffer, unsigned length, uint64_t offset, IoRequest &request)
+    {
+        while (inFlight + pending >= cqEntries)
+        {
+            submit();
+            enter(0, 1, IORING_ENTER_GETEVENTS);
+            reap();
+        }
+        if (pending >= sqEntries)
+        {
+            submit();
+        }
+
+        unsigned tail = *sqTail;
+        unsigned index = tail & sqMask;
+        io_uring_sqe &sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(buffer);
+        sqe.len = length;
+        sqe.off = offset;
+        sqe.user_data = reinterpret_cast<uint64_t>(&request);
+        sqArray[index] = index;
+
+        request.done = false;
+        request.result = 0;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        ++pending;
+    }
+
+    /**
+     * @brief Records all available completions in their request states.
+     */
+    void reap() noexcept
+    {
+        unsigned head = *cqHead;
+        unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe &cqe = cqes[head & cqMask];
+            auto *request = reinterpret_cast<IoRequest *>(cqe.user_data);
+            request->result = cqe.res;
+            request->done = true;
+            head++;
+            --inFlight;
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * @brief Calls io_uring_enter(), retrying when interrupted by a signal.
+     *
+     * @return The number of submitted requests.
+     * @throws std::runtime_error If the system call fails.
+     */
+    unsigned enter(unsigned toSubmit, unsigned minComplete, unsigned flags)
+    {
+        long result;
+        while ((result = ::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0)) < 0)
+        {
+            if (errno != EINTR)
+            {
+                throw std::runtime_error(std::format("io_uring_enter failed: {}", std::strerror(errno)));
+            }
+        }
+        return static_cast<unsigned>(result);
+    }
+
+    /**
+     * @brief Unmaps the rings and closes the ring file descriptor.
+     */
+    void release() noexcept
+    {
+        if (sqes)
+        {
+            ::munmap(sqes, sqesSize);
+        }
+        if (cqRing && cqRing != MAP_FAILED && cqRing != sqRing)
+        {
+            ::munmap(cqRing, cqRingSize);
+        }
+        if (sqRing && sqRing != MAP_FAILED)
+        {
+            ::munmap(sqRing, sqRingSize);
+        }
+        if (ringFd >= 0)
+        {
+            ::close(ringFd);
+        }
+        sqes = nullptr;
+        sqRing = cqRing = nullptr;
+        ringFd = -1;
+    }
+};
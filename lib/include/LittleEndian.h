@@ -0,0 +1,86 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief Stores integers and doubles in little-endian byte order.
+ *
+ * Used for the fixed-layout headers and footers of sidecar and column files, so that a file
+ * written on one machine can be read on another. On little-endian targets the byte loops
+ * compile to plain loads and stores.
+ */
+class LittleEndian
+{
+public:
+    static constexpr bool Native = std::endian::native == std::endian::little; ///< True if no conversion is needed.
+
+    /**
+     * @brief Writes a value.
+     *
+     * @param out Destination of `sizeof(T)` bytes.
+     * @param value The value to write.
+     */
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    static void store(uint8_t *out, T value)
+    {
+        auto bits = std::bit_cast<Bits<T>>(value);
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            out[i] = static_cast<uint8_t>(bits >> (i * 8));
+        }
+    }
+
+    /**
+     * @brief Reads a value.
+     *
+     * @param in Source of `sizeof(T)` bytes.
+     * @return The value.
+     */
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    static T load(const uint8_t *in)
+    {
+        Bits<T> bits = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            bits |= static_cast<Bits<T>>(static_cast<Bits<T>>(in[i]) << (i * 8));
+        }
+        return std::bit_cast<T>(bits);
+    }
+
+    /**
+     * @brief Converts values between native and little-endian byte order in place.
+     *
+     * Does nothing on little-endian targets.
+     *
+     * @param values The values to convert.
+     * @param count The number of values.
+     */
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    static void convert(T *values, size_t count)
+    {
+        if constexpr (!Native)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint8_t bytes[sizeof(T)];
+                store(bytes, values[i]);
+                values[i] = std::bit_cast<T>(bytes);
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Unsigned integer type of the same size as `T`.
+     */
+    template <typename T>
+    using Bits = std::conditional_t<sizeof(T) == 8, uint64_t,
+                                    std::conditional_t<sizeof(T) == 4, uint32_t,
+                                                       std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>>;
+};
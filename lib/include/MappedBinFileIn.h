@@ -0,0 +1,235 @@
+#pragma once
+
+#include "FileIn.h"
+#include "RecordIndex.h"
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <stdexcept>
+#include <format>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Class for reading length-prefixed binary data from a memory-mapped file.
+ *
+ * This class inherits from `FileIn` and reads the same format as `BinFileIn`
+ * (4-byte little-endian size followed by the data content). The whole file is
+ * mapped into memory on `open()` and every record is returned as a view into
+ * the mapping, so no per-record copy or allocation takes place.
+ *
+ * A returned view stays valid until the file is closed or another file is opened.
+ *
+ * A sidecar `RecordIndex` written by `BinFileOut` is loaded on `open()` and lets `seek()`
+ * jump close to any record.
+ */
+class MappedBinFileIn : public FileIn<std::span<const uint8_t>>
+{
+private:
+    const uint8_t *mapping = nullptr; ///< Start of the mapped file.
+    size_t mappingSize = 0;           ///< Size of the mapped file in bytes.
+    size_t position = 0;              ///< Offset of the next record in the mapping.
+    bool opened = false;              ///< Flag indicating whether a file is currently open.
+    RecordIndex index;                ///< Offset index of the open file.
+    bool indexed = false;             ///< Flag indicating whether a matching index was loaded.
+
+public:
+    MappedBinFileIn() = default;
+
+    /**
+     * @brief Destructor that ensures the mapping is released.
+     */
+    ~MappedBinFileIn() { close(); }
+
+    MappedBinFileIn(const MappedBinFileIn &) = delete;
+    MappedBinFileIn &operator=(const MappedBinFileIn &) = delete;
+
+    /**
+     * @brief Opens and maps a binary file for reading.
+     *
+     * @param file The path to the binary file to open.
+     * @throws std::runtime_error If the file cannot be opened or mapped.
+     */
+    void open(std::string_view file) override
+    {
+        close();
+
+        std::string fileName(file);
+        int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error(std::format("Failed to stat file: {}", file));
+        }
+
+        // mmap() rejects zero-length mappings, an empty file is simply an empty stream
+        size_t size = static_cast<size_t>(info.st_size);
+        if (size > 0)
+        {
+            void *address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error(std::format("Failed to map file: {}", file));
+            }
+            ::madvise(address, size, MADV_SEQUENTIAL);
+            mapping = static_cast<const uint8_t *>(address);
+        }
+
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+
+        mappingSize = size;
+        position = 0;
+        opened = true;
+        indexed = index.load(RecordIndex::pathFor(file), size, RecordIndex::modificationTime(file));
+    }
+
+    /**
+     * @brief Unmaps the currently open file.
+     */
+    void close() noexcept override
+    {
+        if (mapping)
+        {
+            ::munmap(const_cast<uint8_t *>(mapping), mappingSize);
+        }
+        mapping = nullptr;
+        mappingSize = 0;
+        position = 0;
+        opened = false;
+        indexed = false;
+    }
+
+    /**
+     * @brief Checks whether a sidecar offset index is used.
+     *
+     * @return True if a matching index was loaded on `open()`.
+     */
+    bool hasIndex() const { return indexed; }
+
+    /**
+     * @brief Moves the read position to a record.
+     *
+     * Positions past the last record leave the file at its end.
+     *
+     * @param record The index of the record read next.
+     * @throws std::runtime_error If the file is not open.
+     */
+    void seek(uint64_t record)
+    {
+        if (!opened)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        auto [offset, skip] = index.locate(record);
+        position = static_cast<size_t>(std::min<uint64_t>(offset, mappingSize));
+        while (skip-- > 0 && skipRecord())
+        {
+        }
+    }
+
+    /**
+     * @brief Gets the number of records in the file.
+     *
+     * Taken from the index if available, otherwise the records are counted without
+     * reading their content. The read position is not affected.
+     *
+     * @return The number of records.
+     * @throws std::runtime_error If the file is not open.
+     */
+    uint64_t recordCount()
+    {
+        if (!opened)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+        if (indexed)
+        {
+            return index.getRecordCount();
+        }
+
+        size_t saved = position;
+        position = 0;
+        uint64_t count = 0;
+        while (skipRecord())
+        {
+            ++count;
+        }
+        position = saved;
+        return count;
+    }
+
+    /**
+     * @brief Reads the next record from the mapped file.
+     *
+     * Reads the size of the data (4 bytes, little-endian) and returns a view of the
+     * following data content. An empty view is returned at the end of the file.
+     *
+     * @return A view of the record bytes inside the mapping.
+     * @throws std::runtime_error If the file is not open or the record is truncated.
+     */
+    std::span<const uint8_t> read() override
+    {
+        if (!opened)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        if (mappingSize - position < sizeof(uint32_t))
+        {
+            return {};
+        }
+
+        // Read size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = 0;
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            dataSize |= static_cast<uint32_t>(mapping[position + i]) << (i * 8);
+        }
+        position += sizeof(dataSize);
+
+        if (mappingSize - position < dataSize)
+        {
+            throw std::runtime_error("Failed to read data content");
+        }
+
+        std::span<const uint8_t> record(mapping + position, dataSize);
+        position += dataSize;
+        return record;
+    }
+
+private:
+    /**
+     * @brief Moves the read position past the next record.
+     *
+     * @return False at the end of the file.
+     */
+    bool skipRecord()
+    {
+        if (mappingSize - position < sizeof(uint32_t))
+        {
+            position = mappingSize;
+            return false;
+        }
+
+        uint32_t dataSize = 0;
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            dataSize |= static_cast<uint32_t>(mapping[position + i]) << (i * 8);
+        }
+        position += sizeof(dataSize) + std::min<size_t>(dataSize, mappingSize - position - sizeof(dataSize));
+        return true;
+    }
+};
@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <format>
 #include "Writer.h"
+#include "DatasetManifest.h"
 
 /**
  * @brief Concept to define the required interface for writer classes.
@@ -28,6 +29,14 @@ concept WriterConcept = requires(T t, const typename T::DataType &data, const st
  * 
  * The OutputManager is used to manage a collection of writer objects and perform operations such as
  * creating new replication directories, registering writers, and closing all writers.
+ * 
+ * With `setManifestEnabled(true)`, every finished replication is recorded in the manifest of the
+ * base path (see `DatasetManifest`), so that readers can list the results without scanning the
+ * folder. The manifest is off by default, finishing a replication then does no extra file I/O.
+ * 
+ * In pooled mode (see `setPooled()`) the writers created by `init()` for the first replication
+ * are kept and retargeted at the files of every following replication, so starting a
+ * replication allocates no writers or buffers.
  */
 class OutputManager
 {
@@ -38,6 +47,11 @@ private:
     std::string currentReplicationName; ///< Name of the current replication (if different).
     std::string currentReplicationPath; ///< Path for the current replication.
     int counter{1}; ///< Counter for generating unique replication names.
+    int currentId{0}; ///< Number of the current replication.
+    bool manifestEnabled{false}; ///< Flag indicating whether finished replications are recorded in the manifest.
+    bool pooled{false}; ///< Flag indicating whether the writers are reused across replications.
+    bool manifestResumed{false}; ///< Flag indicating whether an existing manifest was checked for a torn tail.
+    bool replicationPending{false}; ///< Flag indicating whether the current replication is not recorded yet.
 
 public:
     /**
@@ -53,9 +67,13 @@ public:
     OutputManager(const std::string &path) { setBasePath(path); }
 
     /**
-     * @brief Destructor for OutputManager.
+     * @brief Destructor that closes all writers and records the last replication in the manifest.
      */
-    virtual ~OutputManager() = default;
+    virtual ~OutputManager()
+    {
+        OutputManager::closeAllWriters();
+        recordReplication();
+    }
 
     /**
      * @brief Gets the base path for output files.
@@ -129,6 +147,41 @@ public:
         currentReplicationPath = path;
     }
 
+    /**
+     * @brief Checks whether finished replications are recorded in the manifest.
+     * 
+     * @return True if the manifest is maintained.
+     */
+    bool isManifestEnabled() const { return manifestEnabled; }
+
+    /**
+     * @brief Enables or disables recording finished replications in the manifest.
+     * 
+     * Disabled by default.
+     * 
+     * @param enabled True to maintain the manifest of the base path.
+     */
+    void setManifestEnabled(bool enabled) { manifestEnabled = enabled; }
+
+    /**
+     * @brief Checks whether the writers are reused across replications.
+     * 
+     * @return True if the manager is in pooled mode.
+     */
+    bool isPooled() const { return pooled; }
+
+    /**
+     * @brief Enables or disables reusing the writers across replications.
+     * 
+     * In pooled mode `newReplication()` calls `init()` only for the first replication and
+     * retargets the registered writers with `IWriter::setPath()` afterwards, keeping their
+     * buffers. Writers that must be created for every replication make `retargetWriters()`
+     * fail, and the manager then falls back to `init()`.
+     * 
+     * @param enabled True to reuse the writers.
+     */
+    void setPooled(bool enabled) { pooled = enabled; }
+
     /**
      * @brief Registers a writer to be used in this output manager.
      * 
@@ -168,12 +221,23 @@ public:
      * 
      * This method ensures that all writers are closed, if they are open.
      */
-    void closeAllWriters() noexcept {
+    virtual void closeAllWriters() noexcept {
         for (auto &writer : writers) {
             writer->close();
         }
     }
 
+    /**
+     * @brief Flushes all registered writers.
+     * 
+     * This method writes out any data buffered by the writers without closing them.
+     */
+    void flushAllWriters() {
+        for (auto &writer : writers) {
+            writer->flush();
+        }
+    }
+
     /**
      * @brief Starts a new replication process with a generated name.
      * 
@@ -182,13 +246,60 @@ public:
      */
     void newReplication()
     {
-        closeAllWriters();
-        writers.clear();
+        newReplication(counter);
+    }
+
+    /**
+     * @brief Starts a new replication process with a given number.
+     * 
+     * Finishes the current replication and starts the one named by the replication name
+     * and `id`. Later calls of `newReplication()` continue with the following number.
+     * 
+     * @param id The number of the replication.
+     */
+    void newReplication(int id)
+    {
+        finishReplication();
+        std::string previousReplicationPath = currentReplicationPath;
 
-        setCurrentReplicationName(getName() + std::to_string(counter));
+        currentId = id;
+        setCurrentReplicationName(getName() + std::to_string(id));
         setCurrentReplicationPath(getBasePath() + currentReplicationName + "/");
-        counter++;
+        counter = id + 1;
+
+        createReplicationStorage();
+
+        if (!pooled || writers.empty() || !retargetWriters(previousReplicationPath))
+        {
+            writers.clear();
+            init();
+        }
+        replicationPending = true;
+    }
+
+    /**
+     * @brief Closes all writers and records the current replication in the manifest.
+     * 
+     * Called by `newReplication()` and the destructor. Derived classes that override
+     * `appendToManifest()` call it from their destructor, where the override is still active.
+     */
+    void finishReplication() noexcept
+    {
+        closeAllWriters();
+        recordReplication();
+    }
 
+protected:
+    /**
+     * @brief Creates the storage for the current replication.
+     * 
+     * Creates the directory of the current replication. Derived classes storing replications
+     * differently (e.g. in container files) override this method.
+     * 
+     * @throws std::runtime_error If the directory cannot be created.
+     */
+    virtual void createReplicationStorage()
+    {
         if (!std::filesystem::exists(currentReplicationPath))
         {
             if (!std::filesystem::create_directory(currentReplicationPath))
@@ -196,10 +307,96 @@ public:
                 throw std::runtime_error("Failed to create directory: " + currentReplicationPath);
             }
         }
+    }
+
+    /**
+     * @brief Retargets the registered writers at the current replication in pooled mode.
+     * 
+     * Every writer path below the previous replication path is moved below the current one.
+     * Derived classes whose writers cannot be retargeted override this method to return false.
+     * 
+     * @param previousPath The path of the previous replication.
+     * @return False if a writer does not belong to the previous replication and `init()` must create new ones.
+     */
+    virtual bool retargetWriters(const std::string &previousPath)
+    {
+        for (const auto &writer : writers)
+        {
+            if (!writer->getPath().starts_with(previousPath))
+            {
+                return false;
+            }
+        }
+        for (auto &writer : writers)
+        {
+            writer->setPath(currentReplicationPath + writer->getPath().substr(previousPath.size()));
+        }
+        return true;
+    }
+
+    /**
+     * @brief Appends an entry to the manifest of the base path.
+     * 
+     * The first append drops the remains of an interrupted append left in the file.
+     * Derived classes sharing the manifest with other managers override this method
+     * to serialise the appends.
+     * 
+     * @param entry The entry of the finished replication.
+     * @throws std::runtime_error If the manifest cannot be written.
+     */
+    virtual void appendToManifest(const DatasetManifest::Entry &entry)
+    {
+        std::string manifestPath = DatasetManifest::pathFor(basePath);
+        if (!manifestResumed)
+        {
+            DatasetManifest::dropTornTail(manifestPath);
+            manifestResumed = true;
+        }
+        DatasetManifest::append(manifestPath, entry);
+    }
+
+    /**
+     * @brief Skips the check of the manifest for a torn tail before the first append.
+     * 
+     * Used by derived classes sharing the manifest with other managers, which check it once for all of them.
+     */
+    void skipManifestResume() { manifestResumed = true; }
+
+private:
+    /**
+     * @brief Appends the current replication to the manifest, once its writers are closed.
+     * 
+     * Failures are reported as warnings, readers then fall back to scanning the folder.
+     */
+    void recordReplication() noexcept
+    {
+        if (!replicationPending || !manifestEnabled)
+        {
+            replicationPending = false;
+            return;
+        }
+        replicationPending = false;
 
-        init();
+        try
+        {
+            DatasetManifest::Entry entry{currentReplicationName, currentId, {}};
+            for (const auto &writer : writers)
+            {
+                const std::string &path = writer->getPath();
+                std::string file = path.starts_with(currentReplicationPath) ? path.substr(currentReplicationPath.size()) : path;
+                std::error_code error;
+                uint64_t bytes = std::filesystem::file_size(path, error);
+                entry.streams.push_back({file, writer->getRecordCount(), error ? 0 : bytes});
+            }
+            appendToManifest(entry);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: Failed to update manifest: " << e.what() << std::endl;
+        }
     }
 
+public:
     /**
      * @brief Abstract method for initializing the writers for the new replication.
      * 
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <optional>
+#include <exception>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief Concept for readers whose file handler must be used by a single thread.
+ *
+ * File handlers tied to the thread that opened them (e.g. `UringBinFileIn`, which submits
+ * to that thread's ring) declare `static constexpr bool ThreadAffine = true`.
+ *
+ * @tparam R The reader type, providing `getFile()`.
+ */
+template <typename R>
+concept ThreadAffineReader = requires(R &reader) {
+    requires std::remove_cvref_t<decltype(reader.getFile())>::ThreadAffine;
+};
+
+/**
+ * @brief Reader adapter that reads and decodes records on a background thread.
+ *
+ * The adapter derives from a `Reader<T, C, F>` type and overrides its `tryRead()` and
+ * `prefetch()`: a worker thread reads the file with the reader's own `tryRead()`,
+ * collecting the decoded records in batches. The worker starts as soon as the reader is
+ * prefetched, which `Statistics::processAllReplications()` does for the next replication
+ * while the current one is processed, or otherwise on the first `tryRead()`. The consumer drains one batch while the worker
+ * fills the next ones, with at most `batchCount` batches waiting, so I/O and decoding overlap
+ * with the consumer's work. Everything built on `tryRead()` (`read()`, `load()`, `records()`,
+ * `generate()`) is prefetched, so code holding the adapter through a pointer to the base
+ * reader needs no change.
+ *
+ * Only one consumer thread may use the adapter. Errors of the worker are rethrown by
+ * `tryRead()` once the records read before them are consumed. The file is opened and closed
+ * by the consumer but read by the worker, so file handlers that must stay on one thread
+ * (`ThreadAffineReader`) are rejected. `seek()`, `readRange()` and `recordCount()` stop the
+ * worker before they use the file; they are not virtual, so they must be called on the
+ * adapter rather than through a pointer to the base reader.
+ *
+ * @tparam R The reader type, a `Reader<T, C, F>` or a class derived from it.
+ */
+template <typename R>
+class PrefetchReader : public R
+{
+    static_assert(!ThreadAffineReader<R>, "PrefetchReader reads on a worker thread, the file handler must not be thread-affine");
+
+public:
+    using RecordType = typename decltype(std::declval<R &>().tryRead())::value_type; ///< Type of the records.
+
+    static constexpr size_t DefaultBatchSize = 4096; ///< Default number of records in a batch.
+    static constexpr size_t DefaultBatchCount = 2;   ///< Default number of batches read ahead.
+
+private:
+    size_t batchSize = DefaultBatchSize;   ///< Number of records in a batch.
+    size_t batchCount = DefaultBatchCount; ///< Maximum number of batches read ahead.
+
+    std::thread worker;                         ///< Thread reading the file.
+    std::mutex mutex;                           ///< Guards the state shared with the worker.
+    std::condition_variable filledSignal;       ///< Signalled when a batch is added or the worker ends.
+    std::condition_variable spaceSignal;        ///< Signalled when a batch is taken or stopping is requested.
+    std::deque<std::vector<RecordType>> filled; ///< Batches read ahead.
+    bool finished = false;                      ///< Whether the worker reached the end of the file or failed.
+    bool stopping = false;                      ///< Whether the worker is asked to stop.
+    std::exception_ptr error;                   ///< Error of the worker.
+
+    std::vector<RecordType> current; ///< Batch being consumed.
+    size_t position = 0;             ///< Index of the next record in `current`.
+    size_t nextRecord = 0;           ///< Index of the next record in the file the consumer takes.
+
+public:
+    using R::R;
+
+    /**
+     * @brief Destructor that stops the worker thread.
+     */
+    ~PrefetchReader() override { stop(); }
+
+    /**
+     * @brief Sets the size and number of the batches read ahead.
+     *
+     * Takes effect the next time the worker starts, i.e. after `close()`.
+     *
+     * @param size The number of records in a batch.
+     * @param count The maximum number of batches read ahead.
+     */
+    void setPrefetch(size_t size, size_t count)
+    {
+        batchSize = size > 0 ? size : DefaultBatchSize;
+        batchCount = count > 0 ? count : DefaultBatchCount;
+    }
+
+    /**
+     * @brief Takes the next record read by the worker thread.
+     *
+     * @return The record, or no value at the end of the file.
+     * @throws std::runtime_error If the worker failed to read or convert a record.
+     */
+    std::optional<RecordType> tryRead() override
+    {
+        if (position >= current.size())
+        {
+            if (!worker.joinable())
+            {
+                start();
+            }
+
+            std::unique_lock lock(mutex);
+            filledSignal.wait(lock, [this] { return !filled.empty() || finished; });
+            if (filled.empty())
+            {
+                if (error)
+                {
+                    std::rethrow_exception(std::exchange(error, {}));
+                }
+                return std::nullopt;
+            }
+            current = std::move(filled.front());
+            filled.pop_front();
+            position = 0;
+            lock.unlock();
+            spaceSignal.notify_one();
+        }
+        ++nextRecord;
+        return std::move(current[position++]);
+    }
+
+    /**
+     * @brief Stops the worker thread, discards the records read ahead and moves the read position to a record.
+     *
+     * @param recordIndex The index of the record read next.
+     * @throws std::runtime_error If the file cannot be opened or reading fails.
+     */
+    void seek(size_t recordIndex)
+        requires requires(R &reader) { reader.seek(size_t{}); }
+    {
+        stop();
+        R::seek(recordIndex);
+        nextRecord = recordIndex;
+    }
+
+    /**
+     * @brief Gets the number of records in the file.
+     *
+     * A running worker thread is stopped first, the next read continues after the last
+     * record taken.
+     *
+     * @return The number of records.
+     * @throws std::runtime_error If the file cannot be opened or reading fails.
+     */
+    size_t recordCount()
+        requires requires(R &reader) { reader.recordCount(); reader.seek(size_t{}); }
+    {
+        if (worker.joinable())
+        {
+            stop();
+            R::seek(nextRecord);
+        }
+        return R::recordCount();
+    }
+
+    /**
+     * @brief Stops the worker thread, discards the records read ahead and reads the records in the range [begin, end).
+     *
+     * @param begin The index of the first record.
+     * @param end The index past the last record, clamped to the end of the file.
+     * @return The converted records.
+     * @throws std::runtime_error If the file cannot be opened or reading/converting fails.
+     */
+    std::vector<RecordType> readRange(size_t begin, size_t end)
+        requires requires(R &reader) { reader.readRange(size_t{}, size_t{}); }
+    {
+        stop();
+        auto result = R::readRange(begin, end);
+        nextRecord = begin + result.size();
+        return result;
+    }
+
+    /**
+     * @brief Opens the file and starts the worker thread reading ahead.
+     *
+     * Does nothing if the worker is running; if the file cannot be opened, the error is
+     * reported by the next read.
+     */
+    void prefetch() override
+    {
+        R::prefetch();
+        if (this->isFileOpen() && !worker.joinable())
+        {
+            start();
+        }
+    }
+
+    /**
+     * @brief Stops the worker thread and closes the file.
+     */
+    void close() override
+    {
+        stop();
+        nextRecord = 0;
+        R::close();
+    }
+
+private:
+    /**
+     * @brief Starts the worker thread reading from the current position.
+     */
+    void start()
+    {
+        finished = false;
+        stopping = false;
+        error = nullptr;
+        worker = std::thread([this] { run(); });
+    }
+
+    /**
+     * @brief Stops the worker thread and discards the records read ahead.
+     */
+    void stop() noexcept
+    {
+        if (worker.joinable())
+        {
+            {
+                std::lock_guard lock(mutex);
+                stopping = true;
+            }
+            spaceSignal.notify_all();
+            worker.join();
+        }
+        filled.clear();
+        current.clear();
+        position = 0;
+        finished = false;
+        stopping = false;
+        error = nullptr;
+    }
+
+    /**
+     * @brief Body of the worker thread, reads batches until the end of the file.
+     */
+    void run()
+    {
+        try
+        {
+            bool end = false;
+            while (!end)
+            {
+                std::vector<RecordType> batch;
+                batch.reserve(batchSize);
+                while (batch.size() < batchSize)
+                {
+                    auto item = R::tryRead();
+                    if (!item)
+                    {
+                        end = true;
+                        break;
+                    }
+                    batch.push_back(std::move(*item));
+                }
+
+                std::unique_lock lock(mutex);
+                spaceSignal.wait(lock, [this] { return filled.size() < batchCount || stopping; });
+                if (stopping)
+                {
+                    return;
+                }
+                if (!batch.empty())
+                {
+                    filled.push_back(std::move(batch));
+                }
+                lock.unlock();
+                filledSignal.notify_one();
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard lock(mutex);
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard lock(mutex);
+            finished = true;
+        }
+        filledSignal.notify_one();
+    }
+};
@@ -2,6 +2,9 @@
 
 #include "FolderStatistics.h"
 #include "InputManager.h"
+#include "ContainerFormat.h"
+#include "ArchiveIndex.h"
+#include "DatasetManifest.h"
 #include "Presenter.h"
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
@@ -12,7 +15,6 @@
 #include <filesystem>
 #include <string>
 #include <functional>
-#include <algorithm> // For std::sort
 
 /**
  * @brief A singleton class that manages the presentation and interaction with the UI.
@@ -99,6 +101,10 @@ private:
 
     /**
      * @brief Scans the folder at the specified path and updates the list of folder names and their selection status.
+     * 
+     * Replications stored in container files are listed by their name without the extension.
+     * The folder is only scanned if it has neither an archive index nor a current manifest.
+     * 
      * @param path The path to scan for folders.
      */
     void scanFolders(std::string_view path) {
@@ -106,22 +112,43 @@ private:
         folderSelections.clear();
 
         try {
-            std::vector<std::filesystem::directory_entry> entries;
-            for (const auto& entry : std::filesystem::directory_iterator(path)) {
-                if (entry.is_directory()) {
-                    entries.push_back(entry);
+            std::vector<std::string> names;
+            bool sorted = false;
+            std::string folder = (std::filesystem::path(path) / "").string();
+            ArchiveIndex archive;
+            DatasetManifest manifest;
+            if (archive.load(ArchiveIndex::pathFor(folder))) {
+                // Replications packed in an archive are listed by its index
+                for (const auto& entry : archive.getEntries()) {
+                    if (archive.find(entry.name) == &entry) {
+                        names.push_back(entry.name);
+                    }
+                }
+            } else if (DatasetManifest::isCurrent(folder) && manifest.load(DatasetManifest::pathFor(folder))) {
+                // The manifest lists the replications already sorted
+                for (const auto& entry : manifest.getEntries()) {
+                    names.push_back(entry.name);
+                }
+                sorted = true;
+            } else {
+                for (const auto& entry : std::filesystem::directory_iterator(path)) {
+                    if (entry.is_directory()) {
+                        names.push_back(entry.path().filename().string());
+                    } else if (entry.is_regular_file() && entry.path().extension() == ContainerFormat::Extension) {
+                        names.push_back(entry.path().stem().string());
+                    }
                 }
             }
 
-            std::sort(entries.begin(), entries.end(),
-                      [](const std::filesystem::directory_entry& a, const std::filesystem::directory_entry& b) {
-                          return a.path().filename().string() < b.path().filename().string();
-                      });
+            // Scanned and archived replications are listed in the order of the manifest
+            if (!sorted) {
+                DatasetManifest::sortNames(names);
+            }
 
-            folderNames.reserve(entries.size());
-            folderSelections.reserve(entries.size());
-            for (const auto& entry : entries) {
-                folderNames.push_back(entry.path().filename().string());
+            folderNames.reserve(names.size());
+            folderSelections.reserve(names.size());
+            for (auto& name : names) {
+                folderNames.push_back(std::move(name));
                 folderSelections.push_back(false);
             }
         } catch (const std::exception& e) {
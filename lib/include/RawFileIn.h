@@ -0,0 +1,228 @@
+#pragma once
+
+#include "FileIn.h"
+#include "RawHeader.h"
+#include <vector>
+#include <span>
+#include <optional>
+#include <cstdint>
+#include <cerrno>
+#include <string>
+#include <stdexcept>
+#include <format>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Class for reading scalar values from a raw column file written by `RawFileOut`.
+ *
+ * The number of values is derived from the file length on `open()`, so the values can be
+ * loaded with one bulk read into memory sized up front (`readInto()`), or used in place
+ * from a private memory mapping (`map()`). `read()` returns the values one by one.
+ *
+ * @tparam T The scalar type of the values, it must match the type stored in the header.
+ */
+template <RawScalar T>
+class RawFileIn : public FileIn<T>
+{
+public:
+    static constexpr size_t DefaultBufferSize = 8192; ///< Number of values fetched at once by `read()`.
+
+private:
+    std::string path;            ///< Path of the open file.
+    int fd = -1;                 ///< File descriptor of the open file.
+    uint64_t count = 0;          ///< Number of complete values in the file.
+    uint64_t position = 0;       ///< Index of the next value fetched from the file.
+    std::vector<T> buffer;       ///< Values fetched for `read()`.
+    size_t bufferPosition = 0;   ///< Index of the next value in `buffer`.
+    void *mapAddress = nullptr;  ///< Start of the mapping created by `map()`.
+    size_t mapLength = 0;        ///< Length of the mapping in bytes.
+
+public:
+    RawFileIn() = default;
+
+    /**
+     * @brief Destructor that closes the file and releases the mapping.
+     */
+    ~RawFileIn() { close(); }
+
+    /**
+     * @brief Opens a raw column file and validates its header.
+     *
+     * @param file The path to the file to open.
+     * @throws std::runtime_error If the file cannot be opened or holds values of another type.
+     */
+    void open(std::string_view file) override
+    {
+        close();
+        path = file;
+
+        fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        struct stat info{};
+        uint8_t bytes[RawHeader::Size];
+        RawHeader header;
+        if (::fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < RawHeader::Size ||
+            ::pread(fd, bytes, sizeof(bytes), 0) != static_cast<ssize_t>(sizeof(bytes)) || !header.load(bytes))
+        {
+            close();
+            throw std::runtime_error(std::format("Invalid raw file: {}", file));
+        }
+        if (header.type != RawHeader::typeOf<T>() || header.elementSize != sizeof(T))
+        {
+            close();
+            throw std::runtime_error(std::format("Unexpected value type in raw file: {}", file));
+        }
+        if (header.byteOrder != RawHeader::NativeOrder)
+        {
+            close();
+            throw std::runtime_error(std::format("Unexpected byte order in raw file: {}", file));
+        }
+
+        // A writer that did not finish leaves the count at 0, the length is authoritative
+        count = (static_cast<uint64_t>(info.st_size) - RawHeader::Size) / sizeof(T);
+    }
+
+    /**
+     * @brief Closes the file and releases the mapping.
+     */
+    void close() noexcept override
+    {
+        if (mapAddress)
+        {
+            ::munmap(mapAddress, mapLength);
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+        fd = -1;
+        mapAddress = nullptr;
+        mapLength = 0;
+        count = 0;
+        position = 0;
+        buffer.clear();
+        bufferPosition = 0;
+    }
+
+    /**
+     * @brief Gets the number of values in the file.
+     */
+    uint64_t size() const { return count; }
+
+    /**
+     * @brief Reads the next value.
+     *
+     * @return The value.
+     * @throws std::runtime_error If the file is not open, reading fails or the end of the file is reached.
+     */
+    T read() override
+    {
+        auto value = tryRead();
+        if (!value)
+        {
+            throw std::runtime_error("End of file reached");
+        }
+        return *value;
+    }
+
+    /**
+     * @brief Reads the next value, signalling the end of the file without exceptions.
+     *
+     * @return The value, or no value at the end of the file.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    std::optional<T> tryRead() override
+    {
+        if (bufferPosition >= buffer.size())
+        {
+            buffer.resize(static_cast<size_t>(std::min<uint64_t>(DefaultBufferSize, count - std::min(position, count))));
+            if (buffer.empty())
+            {
+                return std::nullopt;
+            }
+            buffer.resize(readInto(buffer));
+            bufferPosition = 0;
+        }
+        return buffer[bufferPosition++];
+    }
+
+    /**
+     * @brief Reads the following values into a destination with one bulk read.
+     *
+     * @param destination The memory receiving the values, e.g. `arma::vec::memptr()`.
+     * @return The number of values read, smaller than the destination at the end of the file.
+     * @throws std::runtime_error If the file is not open or reading fails.
+     */
+    size_t readInto(std::span<T> destination)
+    {
+        if (fd < 0)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        size_t values = static_cast<size_t>(std::min<uint64_t>(destination.size(), count - std::min(position, count)));
+        auto *out = reinterpret_cast<char *>(destination.data());
+        size_t remaining = values * sizeof(T);
+        off_t offset = static_cast<off_t>(RawHeader::Size + position * sizeof(T));
+        while (remaining > 0)
+        {
+            ssize_t result = ::pread(fd, out, remaining, offset);
+            if (result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (result <= 0)
+            {
+                throw std::runtime_error(std::format("Failed to read file: {}", path));
+            }
+            out += result;
+            offset += result;
+            remaining -= static_cast<size_t>(result);
+        }
+        position += values;
+        return values;
+    }
+
+    /**
+     * @brief Maps the values of the file into memory.
+     *
+     * The mapping is private: pages are loaded on first access, and changes made through the
+     * view are never written back to the file. The view stays valid until the file is closed,
+     * which makes it suitable for Armadillo's auxiliary-memory constructor
+     * `arma::vec(view.data(), view.size(), false, true)`.
+     *
+     * @return A view of all values in the file.
+     * @throws std::runtime_error If the file is not open or cannot be mapped.
+     */
+    std::span<T> map()
+    {
+        if (fd < 0)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+        if (count == 0)
+        {
+            return {};
+        }
+        if (!mapAddress)
+        {
+            size_t length = static_cast<size_t>(RawHeader::Size + count * sizeof(T));
+            void *address = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+            {
+                throw std::runtime_error(std::format("Failed to map file: {}", path));
+            }
+            mapAddress = address;
+            mapLength = length;
+        }
+        return {reinterpret_cast<T *>(static_cast<uint8_t *>(mapAddress) + RawHeader::Size), static_cast<size_t>(count)};
+    }
+};
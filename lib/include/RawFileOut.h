@@ -0,0 +1,182 @@
+#pragma once
+
+#include "FileOut.h"
+#include "RawHeader.h"
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <string>
+#include <iostream>
+#include <format>
+
+/**
+ * @brief Class for writing scalar values to a raw column file.
+ *
+ * This class inherits from `FileOut` and stores values of type `T` tightly packed after a
+ * `RawHeader`, without per-record length prefixes (see `RawHeader` for the layout). Values
+ * are collected in a buffer and written in bulk; the header count is written on `close()`.
+ *
+ * @tparam T The scalar type of the values.
+ */
+template <RawScalar T>
+class RawFileOut : public FileOut<T>
+{
+public:
+    static constexpr size_t DefaultBufferSize = 8192; ///< Default number of buffered values.
+
+private:
+    std::vector<T> buffer; ///< Values not yet written to the file.
+    uint64_t count = 0;    ///< Number of values written, including buffered ones.
+    size_t bufferSize;     ///< Number of values buffered before they are written.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of buffered values.
+     */
+    explicit RawFileOut(size_t size = DefaultBufferSize) : bufferSize(size > 0 ? size : DefaultBufferSize) {}
+
+    /**
+     * @brief Destructor that writes out buffered values and closes the file.
+     */
+    ~RawFileOut() { close(); }
+
+    /**
+     * @brief Opens (and truncates) a raw column file and writes its header.
+     *
+     * @param file The path to the file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+        this->outFile.open(std::string(file), std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!this->outFile)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        count = 0;
+        buffer.clear();
+        buffer.reserve(bufferSize);
+        writeHeader();
+    }
+
+    /**
+     * @brief Writes out buffered values, updates the header count and closes the file.
+     */
+    void close() noexcept override
+    {
+        if (!this->outFile.is_open())
+        {
+            return;
+        }
+
+        try
+        {
+            writeBuffer();
+            this->outFile.seekp(0);
+            writeHeader();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: Failed to write raw header: " << e.what() << std::endl;
+        }
+        this->outFile.close();
+    }
+
+    /**
+     * @brief Writes a single value.
+     *
+     * @param data The value to write.
+     * @throws std::runtime_error If the file is not open or writing fails.
+     */
+    void write(const T &data) override
+    {
+        if (!this->outFile.is_open())
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+
+        buffer.push_back(data);
+        ++count;
+        if (buffer.size() >= bufferSize)
+        {
+            writeBuffer();
+        }
+    }
+
+    /**
+     * @brief Writes a contiguous range of values with one bulk write.
+     *
+     * @param data The values to write.
+     * @throws std::runtime_error If the file is not open or writing fails.
+     */
+    void write(std::span<const T> data)
+    {
+        if (!this->outFile.is_open())
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+
+        writeBuffer();
+        this->outFile.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size_bytes()));
+        if (!this->outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+        count += data.size();
+    }
+
+    /**
+     * @brief Writes out buffered values and flushes the stream.
+     *
+     * @throws std::runtime_error If writing fails.
+     */
+    void flush() override
+    {
+        if (this->outFile.is_open())
+        {
+            writeBuffer();
+            this->outFile.flush();
+        }
+    }
+
+private:
+    /**
+     * @brief Writes the header with the current count at the current position.
+     */
+    void writeHeader()
+    {
+        RawHeader header;
+        header.type = RawHeader::typeOf<T>();
+        header.elementSize = sizeof(T);
+        header.count = count;
+
+        uint8_t bytes[RawHeader::Size];
+        header.store(bytes);
+        this->outFile.write(reinterpret_cast<const char *>(bytes), sizeof(bytes));
+        if (!this->outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+    }
+
+    /**
+     * @brief Writes the buffered values.
+     */
+    void writeBuffer()
+    {
+        if (buffer.empty())
+        {
+            return;
+        }
+        this->outFile.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(T)));
+        if (!this->outFile)
+        {
+            throw std::runtime_error("Failed to write data block");
+        }
+        buffer.clear();
+    }
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "LittleEndian.h"
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @brief Element types of raw column files.
+ */
+enum class RawType : uint32_t
+{
+    FLOAT64 = 1, ///< double
+    FLOAT32 = 2, ///< float
+    INT64 = 3,   ///< int64_t
+    INT32 = 4,   ///< int32_t
+    UINT64 = 5,  ///< uint64_t
+    UINT32 = 6,  ///< uint32_t
+};
+
+/**
+ * @brief Concept for scalar types that can be stored in raw column files.
+ *
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept RawScalar = std::is_same_v<T, double> || std::is_same_v<T, float> ||
+                    std::is_same_v<T, int64_t> || std::is_same_v<T, int32_t> ||
+                    std::is_same_v<T, uint64_t> || std::is_same_v<T, uint32_t>;
+
+/**
+ * @brief Header of a raw column file.
+ *
+ * Raw column files (`RawFileOut`, `RawFileIn`) hold a stream of fixed-size scalars without
+ * any per-record framing, so the values can be read with one bulk read or used in place
+ * from a memory mapping:
+ *
+ * [header: 4 bytes magic | 4 bytes type | 4 bytes element size | 4 bytes byte order |
+ *  8 bytes count][values, tightly packed]
+ *
+ * The header is little-endian. The values keep the byte order of the writing machine so they
+ * can be used in place; the byte order field records it (0 = little-endian, 1 = big-endian)
+ * and readers reject files of the other order.
+ *
+ * The count is written when the file is closed. Readers derive the number of values from
+ * the file length, so a file whose writer did not finish is still readable up to the last
+ * complete value.
+ */
+struct RawHeader
+{
+    static constexpr uint32_t Magic = 0x57415252;                         ///< Marks a raw column file ("RRAW").
+    static constexpr size_t Size = 24;                                    ///< Size of the header in bytes, a multiple of 8 to keep values aligned.
+    static constexpr uint32_t NativeOrder = LittleEndian::Native ? 0 : 1; ///< Byte order of the values written on this machine.
+
+    RawType type = RawType::FLOAT64;  ///< Type of the values.
+    uint32_t elementSize = 0;         ///< Size of a value in bytes.
+    uint32_t byteOrder = NativeOrder; ///< Byte order of the values (0 = little-endian, 1 = big-endian).
+    uint64_t count = 0;               ///< Number of values, 0 until the writer is closed.
+
+    /**
+     * @brief Gets the type code of a scalar type.
+     *
+     * @tparam T The scalar type.
+     */
+    template <RawScalar T>
+    static constexpr RawType typeOf()
+    {
+        if constexpr (std::is_same_v<T, double>)
+            return RawType::FLOAT64;
+        else if constexpr (std::is_same_v<T, float>)
+            return RawType::FLOAT32;
+        else if constexpr (std::is_same_v<T, int64_t>)
+            return RawType::INT64;
+        else if constexpr (std::is_same_v<T, int32_t>)
+            return RawType::INT32;
+        else if constexpr (std::is_same_v<T, uint64_t>)
+            return RawType::UINT64;
+        else
+            return RawType::UINT32;
+    }
+
+    /**
+     * @brief Writes the header.
+     *
+     * @param out Destination of `Size` bytes.
+     */
+    void store(uint8_t *out) const
+    {
+        LittleEndian::store(out, Magic);
+        LittleEndian::store(out + 4, static_cast<uint32_t>(type));
+        LittleEndian::store(out + 8, elementSize);
+        LittleEndian::store(out + 12, byteOrder);
+        LittleEndian::store(out + 16, count);
+    }
+
+    /**
+     * @brief Reads a header.
+     *
+     * @param in Source of `Size` bytes.
+     * @return True if the bytes start with the magic number.
+     */
+    bool load(const uint8_t *in)
+    {
+        type = static_cast<RawType>(LittleEndian::load<uint32_t>(in + 4));
+        elementSize = LittleEndian::load<uint32_t>(in + 8);
+        byteOrder = LittleEndian::load<uint32_t>(in + 12);
+        count = LittleEndian::load<uint64_t>(in + 16);
+        return LittleEndian::load<uint32_t>(in) == Magic;
+    }
+};
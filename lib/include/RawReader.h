@@ -0,0 +1,228 @@
+#pragma once
+
+#include "Reader.h"
+#include "RawFileIn.h"
+#include "RecordRange.h"
+#include "Generator.h"
+#include <string>
+#include <vector>
+#include <span>
+#include <optional>
+#include <stdexcept>
+#include <iostream>
+#include <format>
+
+/**
+ * @brief Reader class for scalar values stored in a raw column file by `RawWriter`.
+ *
+ * `load()` sizes one contiguous vector from the file length and fills it with a single
+ * bulk read. Callers that keep the values elsewhere (e.g. in an `arma::vec`) use `size()`
+ * and `readInto()` instead, or `map()` to use the values in place.
+ *
+ * @tparam T The scalar type of the values.
+ */
+template <RawScalar T>
+class RawReader : public IReader
+{
+private:
+    RawFileIn<T> file;   ///< File handler instance for managing file operations.
+    std::vector<T> data; ///< Contiguous storage of the loaded values.
+    std::string path;    ///< File path.
+    bool isOpen = false; ///< Flag indicating whether the file is currently open.
+
+public:
+    RawReader() = default;
+
+    /**
+     * @brief Constructs a RawReader with a specified file path.
+     *
+     * @param pFile The file path to be used for reading.
+     */
+    RawReader(const std::string &pFile) : path(pFile) {}
+
+    /**
+     * @brief Destructor that ensures the file is closed if open.
+     */
+    virtual ~RawReader() override
+    {
+        if (isOpen)
+        {
+            close();
+        }
+    }
+
+    /**
+     * @brief Opens the specified file for reading.
+     *
+     * @param pFile The file path to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(std::string_view pFile)
+    {
+        try
+        {
+            file.open(pFile);
+            isOpen = true;
+        }
+        catch (const std::exception &e)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {} ({})", pFile, e.what()));
+        }
+    }
+
+    /**
+     * @brief Closes the file, invalidating views returned by `map()`.
+     */
+    void close()
+    {
+        file.close();
+        isOpen = false;
+    }
+
+    /**
+     * @brief Gets the file handler.
+     *
+     * @return A reference to the file handler instance.
+     */
+    RawFileIn<T> &getFile() { return file; }
+
+    /**
+     * @brief Gets the number of values in the file.
+     *
+     * If the file is not already open, it will be opened.
+     *
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    size_t size()
+    {
+        ensureOpen();
+        return static_cast<size_t>(file.size());
+    }
+
+    /**
+     * @brief Reads a single value from the file.
+     *
+     * @return The value.
+     * @throws std::runtime_error If reading fails or the end of the file is reached.
+     */
+    T read()
+    {
+        ensureOpen();
+        return file.read();
+    }
+
+    /**
+     * @brief Reads a single value, signalling the end of the file without exceptions.
+     *
+     * @return The value, or no value at the end of the file.
+     * @throws std::runtime_error If the file cannot be opened or reading fails.
+     */
+    std::optional<T> tryRead()
+    {
+        ensureOpen();
+        return file.tryRead();
+    }
+
+    /**
+     * @brief Gets a lazy range over the values following the current read position.
+     *
+     * @return A single-pass range of the values, valid while the reader exists.
+     */
+    RecordRange<RawReader> records() { return RecordRange<RawReader>(*this); }
+
+    /**
+     * @brief Gets a generator yielding the values following the current read position.
+     *
+     * @return A generator of the values, valid while the reader exists.
+     * @throws std::runtime_error From the generator, if reading fails.
+     */
+    Generator<T> generate()
+    {
+        while (auto value = tryRead())
+        {
+            co_yield *value;
+        }
+    }
+
+    /**
+     * @brief Reads the following values into a destination with one bulk read.
+     *
+     * @param destination The memory receiving the values.
+     * @return The number of values read.
+     * @throws std::runtime_error If the file cannot be opened or reading fails.
+     */
+    size_t readInto(std::span<T> destination)
+    {
+        ensureOpen();
+        return file.readInto(destination);
+    }
+
+    /**
+     * @brief Maps the values of the file into memory.
+     *
+     * @return A view of all values, valid until the reader is closed.
+     * @throws std::runtime_error If the file cannot be opened or mapped.
+     */
+    std::span<T> map()
+    {
+        ensureOpen();
+        return file.map();
+    }
+
+    /**
+     * @brief Loads all values from the file into memory.
+     *
+     * @throws std::runtime_error If the file path is not set or reading fails.
+     */
+    void load()
+    {
+        ensureOpen();
+        flush();
+
+        try
+        {
+            data.resize(static_cast<size_t>(file.size()));
+            data.resize(file.readInto(data));
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error during load: " << e.what() << std::endl;
+            close();
+            throw;
+        }
+
+        close();
+    }
+
+    /**
+     * @brief Retrieves the stored values.
+     *
+     * @return A constant reference to the contiguous vector of values.
+     */
+    const std::vector<T> &getData() const { return data; }
+
+    /**
+     * @brief Clears all stored values.
+     */
+    void flush()
+    {
+        data.clear();
+        data.shrink_to_fit();
+    }
+
+private:
+    /**
+     * @brief Opens the file given on construction, unless it is already open.
+     */
+    void ensureOpen()
+    {
+        if (!isOpen)
+        {
+            if (path.empty())
+            {
+                throw std::runtime_error("File path is not set");
+            }
+            open(path);
+        }
+    }
+};
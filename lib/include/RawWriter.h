@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Writer.h"
+#include "RawFileOut.h"
+#include <string>
+#include <span>
+#include <ranges>
+#include <stdexcept>
+#include <iostream>
+#include <format>
+
+/**
+ * @brief Writer class that stores scalar values in a raw column file.
+ *
+ * Values are written without conversion or framing (see `RawHeader` for the layout).
+ * Contiguous ranges are passed to the file handler as one bulk write.
+ *
+ * @tparam T The scalar type of the values.
+ */
+template <RawScalar T>
+class RawWriter : public IWriter
+{
+public:
+    using DataType = T; ///< Defines the data type handled by the writer.
+
+private:
+    RawFileOut<T> file;       ///< File handler instance for managing file operations.
+    std::string path;         ///< File path.
+    uint64_t recordCount = 0; ///< Number of values written.
+    bool isOpen = false;      ///< Flag indicating whether the file is currently open.
+
+public:
+    RawWriter() = default;
+
+    /**
+     * @brief Constructs a RawWriter with a specified file path.
+     *
+     * @param pFile The file path to be used for writing.
+     */
+    RawWriter(const std::string &pFile) : path(pFile) {}
+
+    /**
+     * @brief Destructor that ensures the file is closed if open.
+     */
+    virtual ~RawWriter() override
+    {
+        if (isOpen)
+        {
+            close();
+        }
+    }
+
+    /**
+     * @brief Opens the specified file for writing.
+     *
+     * @param pFile The file path to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(std::string_view pFile)
+    {
+        try
+        {
+            file.open(pFile);
+            isOpen = true;
+        }
+        catch (const std::exception &e)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {} ({})", pFile, e.what()));
+        }
+    }
+
+    /**
+     * @brief Closes the file.
+     */
+    void close() override
+    {
+        file.close();
+        isOpen = false;
+    }
+
+    /**
+     * @brief Writes out buffered values.
+     */
+    void flush() override
+    {
+        if (isOpen)
+        {
+            file.flush();
+        }
+    }
+
+    /**
+     * @brief Gets the file handler.
+     *
+     * @return A reference to the file handler instance.
+     */
+    RawFileOut<T> &getFile() { return file; }
+
+    /**
+     * @brief Gets the file path given on construction or by `setPath()`.
+     */
+    const std::string &getPath() const override { return path; }
+
+    /**
+     * @brief Closes the file and retargets the writer, keeping its buffers.
+     *
+     * @param pFile The path of the new file, opened by the next write.
+     */
+    void setPath(const std::string &pFile) override
+    {
+        if (isOpen)
+        {
+            close();
+        }
+        path = pFile;
+        recordCount = 0;
+    }
+
+    /**
+     * @brief Gets the number of values written.
+     */
+    uint64_t getRecordCount() const override { return recordCount; }
+
+    /**
+     * @brief Writes a single value.
+     *
+     * @param data The value to write.
+     * @throws std::runtime_error If the file path is not set.
+     */
+    void write(const T &data)
+    {
+        ensureOpen();
+        file.write(data);
+        ++recordCount;
+    }
+
+    /**
+     * @brief Writes a range of values.
+     *
+     * Contiguous ranges are written with one bulk write.
+     *
+     * @tparam Range The type of the range containing the values.
+     * @param dataRange The range of values to write.
+     * @throws std::runtime_error If the file path is not set.
+     */
+    template <std::ranges::range Range>
+    void write(const Range &dataRange)
+    {
+        ensureOpen();
+        if constexpr (std::ranges::contiguous_range<Range> && std::same_as<std::ranges::range_value_t<Range>, T>)
+        {
+            std::span<const T> values(std::ranges::data(dataRange), std::ranges::size(dataRange));
+            file.write(values);
+            recordCount += values.size();
+        }
+        else
+        {
+            for (const T &item : dataRange)
+            {
+                file.write(item);
+                ++recordCount;
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Opens the file given on construction, unless it is already open.
+     */
+    void ensureOpen()
+    {
+        if (!isOpen)
+        {
+            if (path.empty())
+            {
+                throw std::runtime_error("File path is not set");
+            }
+            open(path);
+        }
+    }
+};
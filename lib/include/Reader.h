@@ -1,11 +1,16 @@
 #pragma once
 
+#include "ReaderStorage.h"
+#include "RecordRange.h"
+#include "Generator.h"
 #include <string>
 #include <vector>
 #include <ostream>
 #include <iostream>
 #include <stdexcept>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <format>
 
 /**
@@ -18,6 +23,14 @@ class IReader
 {
 public:
     virtual ~IReader() = default;
+
+    /**
+     * @brief Starts reading ahead before the records are consumed.
+     *
+     * Called for the readers of the next replication while the current one is processed.
+     * Errors are left to the read that consumes the records. Does nothing by default.
+     */
+    virtual void prefetch() {}
 };
 
 /**
@@ -42,19 +55,51 @@ concept ConverterType = requires(T converter, const O &output, const T &input, c
  * This template class provides a mechanism for reading data of type `T`
  * from a file using a converter `C` and a file handler `F`.
  *
+ * The storage policy `S` decides how loaded data is kept: `PointerStorage` keeps one
+ * allocation per record, `ContiguousStorage` keeps the values in one vector and exposes
+ * them as a `std::span`.
+ *
  * @tparam T The type of data being read.
  * @tparam C The converter class responsible for transforming input data.
  * @tparam F The file handling class that manages file operations.
+ * @tparam S The storage policy for loaded data.
  */
-template <typename T, typename C, typename F>
+template <typename T, typename C, typename F, ReaderStoragePolicy<T> S = PointerStorage<T>>
 class Reader : public IReader
 {
 private:
-    C converter;                            ///< Converter instance for transforming data.
-    F file;                                 ///< File handler instance for managing file operations.
-    std::vector<std::unique_ptr<T>> data{}; ///< Container for storing read data.
-    std::string path;                       ///< File path.
-    bool isOpen = false;                    ///< Flag indicating whether the file is currently open.
+    C converter;         ///< Converter instance for transforming data.
+    F file;              ///< File handler instance for managing file operations.
+    S data{};            ///< Storage for loaded data.
+    std::string path;    ///< File path.
+    bool isOpen = false; ///< Flag indicating whether the file is currently open.
+
+    /**
+     * @brief Converts a record returned by the file handler.
+     *
+     * Views returned by zero-copy file handlers (e.g. `MappedBinFileIn`) are passed
+     * to the converter directly when it accepts them, or to its `decode()` for views.
+     * Otherwise the record is copied into the converter's `OutputType` first.
+     *
+     * @param fileData The record as returned by the file handler.
+     * @return The converted data.
+     */
+    template <typename O>
+    T decode(const O &fileData)
+    {
+        if constexpr (requires { converter.convert(fileData); })
+        {
+            return converter.convert(fileData);
+        }
+        else if constexpr (requires { converter.decode(fileData); })
+        {
+            return converter.decode(fileData);
+        }
+        else
+        {
+            return converter.convert(typename C::OutputType(fileData.begin(), fileData.end()));
+        }
+    }
 
 public:
     Reader() = default;
@@ -118,6 +163,113 @@ public:
         }
     }
 
+    /**
+     * @brief Checks whether the file is open.
+     */
+    bool isFileOpen() const { return isOpen; }
+
+    /**
+     * @brief Opens the file ahead of reading.
+     *
+     * File handlers that read ahead once opened (e.g. `UringBinFileIn`) start their reads,
+     * so the I/O overlaps with the processing of other files. Does nothing if the file is
+     * open or cannot be opened; the next read reports the error.
+     */
+    void prefetch() override
+    {
+        if (isOpen || path.empty())
+        {
+            return;
+        }
+        try
+        {
+            open(path);
+        }
+        catch (const std::exception &)
+        {
+            // Reported when the records are read
+        }
+    }
+
+    /**
+     * @brief Gets the file handler.
+     *
+     * Allows configuring the file handler (e.g. its block size) before reading.
+     *
+     * @return A reference to the file handler instance.
+     */
+    F &getFile() { return file; }
+
+    /**
+     * @brief Moves the read position to a record.
+     *
+     * Available for file handlers with random access (e.g. `BinFileIn` or `MappedBinFileIn`),
+     * which use the sidecar offset index written by `BinFileOut` when present.
+     * If the file is not already open, it will be opened.
+     *
+     * @param recordIndex The index of the record read next.
+     * @throws std::runtime_error If the file cannot be opened or reading fails.
+     */
+    void seek(size_t recordIndex)
+        requires requires(F &f) { f.seek(uint64_t{}); }
+    {
+        if (!isOpen)
+        {
+            open(path);
+        }
+        file.seek(recordIndex);
+    }
+
+    /**
+     * @brief Gets the number of records in the file.
+     *
+     * Useful for splitting a file into ranges processed by several readers in parallel.
+     * If the file is not already open, it will be opened.
+     *
+     * @return The number of records.
+     * @throws std::runtime_error If the file cannot be opened or reading fails.
+     */
+    size_t recordCount()
+        requires requires(F &f) { f.recordCount(); }
+    {
+        if (!isOpen)
+        {
+            open(path);
+        }
+        return static_cast<size_t>(file.recordCount());
+    }
+
+    /**
+     * @brief Reads the records in the range [begin, end).
+     *
+     * The records are returned directly and not added to the stored data. Every reader
+     * keeps its own read position, so several readers of the same file can read
+     * disjoint ranges concurrently.
+     *
+     * @param begin The index of the first record.
+     * @param end The index past the last record, clamped to the end of the file.
+     * @return The converted records.
+     * @throws std::runtime_error If the file cannot be opened or reading/converting fails.
+     */
+    std::vector<T> readRange(size_t begin, size_t end)
+        requires requires(F &f) { f.seek(uint64_t{}); }
+    {
+        seek(begin);
+
+        std::vector<T> result;
+        result.reserve(end > begin ? end - begin : 0);
+        for (size_t i = begin; i < end; ++i)
+        {
+            auto fileData = file.read();
+            if (fileData.empty())
+            {
+                break;
+            }
+            result.push_back(decode(fileData));
+        }
+        return result;
+    }
+
     /**
      * @brief Reads a single data entry from the file.
      *
@@ -128,6 +280,25 @@ public:
      * @throws std::runtime_error If reading fails or the end of the file is reached.
      */
     virtual std::unique_ptr<T> read()
+    {
+        auto item = tryRead();
+        if (!item)
+        {
+            throw std::runtime_error("Failed to read/convert data: End of file reached");
+        }
+        return std::make_unique<T>(std::move(*item));
+    }
+
+    /**
+     * @brief Reads a single data entry from the file, signalling the end of the file without exceptions.
+     *
+     * If the file is not already open, it will be opened. An empty record ends the file,
+     * as it does for `read()`.
+     *
+     * @return The read data, or no value at the end of the file.
+     * @throws std::runtime_error If reading or converting fails.
+     */
+    virtual std::optional<T> tryRead()
     {
         if (!isOpen)
         {
@@ -136,27 +307,22 @@ public:
 
         try
         {
-            // Read data from the file - handle both string and binary data
-            auto fileData = file.read();
-
-            // Check if we reached end of file
-            if constexpr (std::is_same_v<decltype(fileData), std::string>)
+            auto fileData = file.tryRead();
+            if (!fileData)
             {
-                if (fileData.empty())
-                {
-                    throw std::runtime_error("End of file reached");
-                }
+                return std::nullopt;
             }
-            else if constexpr (std::is_same_v<decltype(fileData), std::vector<uint8_t>>)
+
+            // String, byte vector and view records alike end the file when empty
+            if constexpr (requires { fileData->empty(); })
             {
-                if (fileData.empty())
+                if (fileData->empty())
                 {
-                    throw std::runtime_error("End of file reached");
+                    return std::nullopt;
                 }
             }
 
-            // Convert and return the data
-            return std::make_unique<T>(converter.convert(fileData));
+            return decode(*fileData);
         }
         catch (const std::exception &e)
         {
@@ -164,13 +330,44 @@ public:
         }
     }
 
+    /**
+     * @brief Gets a lazy range over the records following the current read position.
+     *
+     * The records are decoded one at a time as the range is iterated and are not added to
+     * the stored data, so a file of any size can be processed in constant memory, e.g.
+     * `for (double value : reader.records()) sum += value;`.
+     *
+     * @return A single-pass range of the records, valid while the reader exists.
+     */
+    RecordRange<Reader> records() { return RecordRange<Reader>(*this); }
+
+    /**
+     * @brief Gets a generator yielding the records following the current read position.
+     *
+     * The generator is the decoding stage of a coroutine pipeline: each record is read and
+     * decoded when the consumer resumes it. Generators of several readers can be advanced
+     * in turn with `Generator::interleave()`.
+     *
+     * @return A generator of the records, valid while the reader exists.
+     * @throws std::runtime_error From the generator, if reading or converting fails.
+     */
+    Generator<T> generate()
+    {
+        while (auto item = tryRead())
+        {
+            co_yield std::move(*item);
+        }
+    }
+
     /**
      * @brief Loads all data from the file into memory.
      *
      * Reads the entire file and stores the data in the internal container.
      * If the file is not already open, it will be opened before reading.
+     * The end of the file is detected without exceptions, a read error stops loading
+     * and is reported on the standard error stream.
      *
-     * @throws std::runtime_error If the file path is not set or an error occurs during reading.
+     * @throws std::runtime_error If the file path is not set or the file cannot be opened.
      */
     void load()
     {
@@ -187,31 +384,14 @@ public:
 
         try
         {
-            while (true)
+            while (auto item = tryRead())
             {
-                try
-                {
-                    auto item = read();
-                    if (item)
-                    {
-                        data.push_back(std::move(item));
-                    }
-                }
-                catch (const std::runtime_error &e)
-                {
-                    if (std::string(e.what()).find("End of file") != std::string::npos)
-                    {
-                        break;
-                    }
-                    std::cerr << "Error reading file: " << e.what() << std::endl;
-                    break; // Prevent infinite loop
-                }
+                data.append(std::move(*item));
             }
         }
-        catch (const std::exception &e)
+        catch (const std::runtime_error &e)
         {
-            std::cerr << "Error during load: " << e.what() << std::endl;
-            throw;
+            std::cerr << "Error reading file: " << e.what() << std::endl;
         }
 
         close();
@@ -220,9 +400,10 @@ public:
     /**
      * @brief Retrieves the stored data.
      *
-     * @return A constant reference to the vector of unique pointers to data objects.
+     * @return The view of the storage policy: a constant reference to the vector of unique
+     *         pointers for `PointerStorage`, a `std::span` of the values for `ContiguousStorage`.
      */
-    const std::vector<std::unique_ptr<T>> &getData() const { return data; }
+    decltype(auto) getData() const { return data.view(); }
 
     /**
      * @brief Clears all stored data.
@@ -232,6 +413,5 @@ public:
     void flush()
     {
         data.clear();
-        data.shrink_to_fit();
     }
 };
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <concepts>
+
+/**
+ * @brief Storage policy keeping every loaded record in its own heap allocation.
+ *
+ * `getData()` of a reader with this policy returns the vector of unique pointers, as
+ * readers always did. This is the default policy of `Reader`.
+ *
+ * @tparam T The type of the stored records.
+ */
+template <typename T>
+class PointerStorage
+{
+private:
+    std::vector<std::unique_ptr<T>> values; ///< Stored records.
+
+public:
+    /**
+     * @brief Adds a record.
+     */
+    void append(T value) { values.push_back(std::make_unique<T>(std::move(value))); }
+
+    /**
+     * @brief Adds a record that is already allocated.
+     */
+    void append(std::unique_ptr<T> value) { values.push_back(std::move(value)); }
+
+    /**
+     * @brief Reserves space for a number of records.
+     */
+    void reserve(size_t count) { values.reserve(count); }
+
+    /**
+     * @brief Gets the number of stored records.
+     */
+    size_t size() const { return values.size(); }
+
+    /**
+     * @brief Removes all records and releases the memory.
+     */
+    void clear()
+    {
+        values.clear();
+        values.shrink_to_fit();
+    }
+
+    /**
+     * @brief Gets the stored records.
+     *
+     * @return A constant reference to the vector of unique pointers to the records.
+     */
+    const std::vector<std::unique_ptr<T>> &view() const { return values; }
+};
+
+/**
+ * @brief Storage policy keeping the loaded records in one contiguous vector.
+ *
+ * Loading needs no allocation per record, and `getData()` of a reader with this policy
+ * returns a `std::span` over the values, which can be passed to numeric kernels or copied
+ * into other containers (e.g. `arma::vec`) with a single copy.
+ *
+ * @tparam T The type of the stored records.
+ */
+template <typename T>
+class ContiguousStorage
+{
+private:
+    std::vector<T> values; ///< Stored records.
+
+public:
+    /**
+     * @brief Adds a record.
+     */
+    void append(T value) { values.push_back(std::move(value)); }
+
+    /**
+     * @brief Adds a record returned by `Reader::read()`.
+     */
+    void append(std::unique_ptr<T> value) { values.push_back(std::move(*value)); }
+
+    /**
+     * @brief Reserves space for a number of records.
+     */
+    void reserve(size_t count) { values.reserve(count); }
+
+    /**
+     * @brief Gets the number of stored records.
+     */
+    size_t size() const { return values.size(); }
+
+    /**
+     * @brief Removes all records and releases the memory.
+     */
+    void clear()
+    {
+        values.clear();
+        values.shrink_to_fit();
+    }
+
+    /**
+     * @brief Gets the stored records.
+     *
+     * @return A view of the contiguous records, valid until the storage is modified.
+     */
+    std::span<const T> view() const { return values; }
+};
+
+/**
+ * @brief Concept for storage policies of `Reader`.
+ *
+ * @tparam S The storage policy.
+ * @tparam T The type of the stored records.
+ */
+template <typename S, typename T>
+concept ReaderStoragePolicy = requires(S storage, const S &constStorage, T value, std::unique_ptr<T> pointer) {
+    { storage.append(std::move(value)) };
+    { storage.append(std::move(pointer)) };
+    { storage.reserve(size_t{}) };
+    { storage.clear() };
+    { constStorage.size() } -> std::convertible_to<size_t>;
+    { constStorage.view() };
+};
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "LittleEndian.h"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <filesystem>
+#include <cstdint>
+#include <chrono>
+#include <utility>
+#include <algorithm>
+
+/**
+ * @brief Sidecar offset index of a length-prefixed record stream.
+ *
+ * Holds the file offset of every `interval`-th record, so that record N is reached by
+ * jumping to the offset of record `N / interval * interval` and skipping at most
+ * `interval - 1` records. The index of `data.bin` is stored next to it as `data.bin.idx`.
+ *
+ * Format (little-endian): [4 bytes magic | 4 bytes interval | 8 bytes record count |
+ * 8 bytes data size | 8 bytes data modification time | 8 bytes offset per indexed record]
+ *
+ * The stored data size and modification time are compared with the stream when the index
+ * is loaded, an index left behind by an older version of the file is ignored.
+ */
+class RecordIndex
+{
+public:
+    static constexpr uint32_t Magic = 0x32444952; ///< Marks an index file ("RID2").
+    static constexpr size_t HeaderSize = 32;      ///< Size of the fixed part of an index file.
+
+private:
+    std::vector<uint64_t> offsets; ///< Offsets of records 0, interval, 2 * interval, ...
+    uint64_t recordCount = 0;      ///< Number of records in the stream.
+    uint64_t dataSize = 0;         ///< Size of the stream in bytes.
+    uint32_t interval = 0;         ///< Number of records between indexed records (0 = no index).
+
+public:
+    RecordIndex() = default;
+
+    /**
+     * @brief Constructs an empty index for a stream being written.
+     *
+     * @param k The number of records between indexed records.
+     */
+    explicit RecordIndex(uint32_t k) : interval(k) {}
+
+    /**
+     * @brief Gets the path of the index belonging to a stream.
+     *
+     * @param file The path of the stream.
+     * @return The path of the sidecar index file.
+     */
+    static std::string pathFor(std::string_view file) { return std::string(file) + ".idx"; }
+
+    /**
+     * @brief Gets the modification time of a stream.
+     *
+     * @param file The path of the stream.
+     * @return The modification time in nanoseconds, or 0 if it cannot be determined.
+     */
+    static int64_t modificationTime(std::string_view file)
+    {
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(std::filesystem::path(file), error);
+        if (error)
+        {
+            return 0;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Checks whether the index holds any entries.
+     */
+    bool valid() const { return interval > 0 && !offsets.empty(); }
+
+    /**
+     * @brief Gets the number of records between indexed records.
+     */
+    uint32_t getInterval() const { return interval; }
+
+    /**
+     * @brief Gets the number of records in the stream.
+     */
+    uint64_t getRecordCount() const { return recordCount; }
+
+    /**
+     * @brief Records a written record.
+     *
+     * @param offset The file offset of the record.
+     * @param size The size of the record including its size prefix.
+     */
+    void add(uint64_t offset, uint64_t size)
+    {
+        if (interval > 0 && recordCount % interval == 0)
+        {
+            offsets.push_back(offset);
+        }
+        ++recordCount;
+        dataSize = offset + size;
+    }
+
+    /**
+     * @brief Finds the nearest indexed record at or before a record.
+     *
+     * @param record The index of the record to reach.
+     * @return The file offset of the nearest indexed record and the number of records to skip from there.
+     */
+    std::pair<uint64_t, uint64_t> locate(uint64_t record) const
+    {
+        if (!valid())
+        {
+            return {0, record};
+        }
+        uint64_t entry = std::min<uint64_t>(record / interval, offsets.size() - 1);
+        return {offsets[entry], record - entry * interval};
+    }
+
+    /**
+     * @brief Writes the index to a file.
+     *
+     * @param file The path of the index file.
+     * @param modified The modification time of the completed stream, see `modificationTime()`.
+     * @return True if the index was written.
+     */
+    bool save(const std::string &file, int64_t modified) const
+    {
+        std::ofstream out(file, std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+
+        std::vector<uint8_t> buffer(HeaderSize + offsets.size() * sizeof(uint64_t));
+        LittleEndian::store(buffer.data(), Magic);
+        LittleEndian::store(buffer.data() + 4, interval);
+        LittleEndian::store(buffer.data() + 8, recordCount);
+        LittleEndian::store(buffer.data() + 16, dataSize);
+        LittleEndian::store(buffer.data() + 24, modified);
+        for (size_t i = 0; i < offsets.size(); ++i)
+        {
+            LittleEndian::store(buffer.data() + HeaderSize + i * sizeof(uint64_t), offsets[i]);
+        }
+
+        out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return static_cast<bool>(out);
+    }
+
+    /**
+     * @brief Reads the index of a stream.
+     *
+     * @param file The path of the index file.
+     * @param expectedSize The current size of the stream in bytes.
+     * @param expectedModified The current modification time of the stream, see `modificationTime()`.
+     * @return True if a matching index was read, otherwise the index is left empty.
+     */
+    bool load(const std::string &file, uint64_t expectedSize, int64_t expectedModified)
+    {
+        *this = RecordIndex();
+
+        std::ifstream in(file, std::ios::binary | std::ios::in);
+        if (!in)
+        {
+            return false;
+        }
+
+        uint8_t header[HeaderSize];
+        in.read(reinterpret_cast<char *>(header), sizeof(header));
+        if (!in)
+        {
+            return false;
+        }
+
+        RecordIndex index;
+        uint32_t magic = LittleEndian::load<uint32_t>(header);
+        index.interval = LittleEndian::load<uint32_t>(header + 4);
+        index.recordCount = LittleEndian::load<uint64_t>(header + 8);
+        index.dataSize = LittleEndian::load<uint64_t>(header + 16);
+        int64_t modified = LittleEndian::load<int64_t>(header + 24);
+        if (magic != Magic || index.interval == 0 || index.dataSize != expectedSize ||
+            modified != expectedModified)
+        {
+            return false;
+        }
+
+        uint64_t entries = (index.recordCount + index.interval - 1) / index.interval;
+        std::error_code error;
+        uint64_t fileSize = std::filesystem::file_size(file, error);
+        if (error || fileSize != sizeof(header) + entries * sizeof(uint64_t))
+        {
+            return false;
+        }
+
+        index.offsets.resize(entries);
+        in.read(reinterpret_cast<char *>(index.offsets.data()), static_cast<std::streamsize>(entries * sizeof(uint64_t)));
+        if (!in)
+        {
+            return false;
+        }
+        LittleEndian::convert(index.offsets.data(), index.offsets.size());
+
+        *this = std::move(index);
+        return true;
+    }
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <ranges>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <cstddef>
+
+/**
+ * @brief Lazy input range over the records of a reader.
+ *
+ * Every increment of the iterator decodes the next record with the reader's `tryRead()`,
+ * so only the current record and the read buffer of the file handler are held in memory.
+ * The range composes with the standard range adaptors, e.g.
+ *
+ * @code
+ * for (double value : reader.records() | std::views::filter(positive))
+ * @endcode
+ *
+ * Like the underlying file, the range is single-pass: iterating it again continues where
+ * the previous iteration stopped. Errors thrown by `tryRead()` propagate out of `begin()`
+ * and the increment operators.
+ *
+ * @tparam R The reader type, providing `tryRead()` returning `std::optional`.
+ */
+template <typename R>
+class RecordRange : public std::ranges::view_interface<RecordRange<R>>
+{
+public:
+    using RecordType = typename decltype(std::declval<R &>().tryRead())::value_type; ///< Type of the records.
+
+    /**
+     * @brief Iterator holding the current record.
+     */
+    class iterator
+    {
+    private:
+        R *reader = nullptr;               ///< Reader the records come from.
+        std::optional<RecordType> current; ///< Current record, empty at the end.
+
+    public:
+        using value_type = RecordType;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+
+        iterator() = default;
+
+        /**
+         * @brief Constructs an iterator and reads the first record.
+         *
+         * @param source The reader to read from.
+         */
+        explicit iterator(R &source) : reader(&source), current(source.tryRead()) {}
+
+        iterator(iterator &&) = default;
+        iterator &operator=(iterator &&) = default;
+
+        /**
+         * @brief Gets the current record.
+         */
+        const RecordType &operator*() const { return *current; }
+
+        /**
+         * @brief Reads the next record.
+         */
+        iterator &operator++()
+        {
+            current = reader->tryRead();
+            return *this;
+        }
+
+        /**
+         * @brief Reads the next record.
+         */
+        void operator++(int) { ++*this; }
+
+        /**
+         * @brief Checks whether the end of the records is reached.
+         */
+        friend bool operator==(const iterator &it, std::default_sentinel_t) { return !it.current; }
+    };
+
+private:
+    R *reader = nullptr; ///< Reader the records come from.
+
+public:
+    RecordRange() = default;
+
+    /**
+     * @brief Constructs the range.
+     *
+     * @param source The reader to read from, it must outlive the range.
+     */
+    explicit RecordRange(R &source) : reader(&source) {}
+
+    /**
+     * @brief Reads the first record and returns an iterator to it.
+     */
+    iterator begin() { return iterator(*reader); }
+
+    /**
+     * @brief Returns the sentinel marking the end of the records.
+     */
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+};
@@ -4,6 +4,8 @@
 #include <vector>
 #include <stdexcept>
 #include <memory>
+#include <string_view>
+#include <concepts>
 #include "Reader.h"
 
 /**
@@ -109,6 +111,17 @@ public:
         return std::static_pointer_cast<R>(readers[index]);
     }
 
+    /**
+     * @brief Lets every registered reader start reading ahead (see `IReader::prefetch()`).
+     */
+    void prefetch()
+    {
+        for (auto &reader : readers)
+        {
+            reader->prefetch();
+        }
+    }
+
     /**
      * @brief Gets the number of registered readers.
      * 
@@ -156,4 +169,16 @@ public:
  * @tparam T The type to check.
  */
 template <typename T>
-concept ReplicationType = std::is_base_of_v<Replication, T>;
\ No newline at end of file
+concept ReplicationType = std::is_base_of_v<Replication, T>;
+
+/**
+ * @brief Concept for replications stored in a single file instead of a directory.
+ * 
+ * Such replications define the extension of their files as `ContainerExtension`.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept ContainerReplicationType = ReplicationType<T> && requires {
+    { T::ContainerExtension } -> std::convertible_to<std::string_view>;
+};
\ No newline at end of file
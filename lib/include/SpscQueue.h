@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <bit>
+#include <utility>
+#include <cstddef>
+
+/**
+ * @brief Bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * The values live in a ring of slots whose count is a power of two. The producer only
+ * writes `tail`, the consumer only writes `head`, and each side publishes its progress with
+ * a release store, so pushing and popping never lock or allocate. The two counters are
+ * kept on separate cache lines to avoid false sharing between the threads.
+ *
+ * Neither side blocks: `tryPush()` fails when the queue is full and `tryPop()` when it is
+ * empty. `waitForSpace()` lets the producer sleep until the consumer frees a slot.
+ *
+ * @tparam T The type of the queued values, it must be default constructible.
+ */
+template <typename T>
+class SpscQueue
+{
+private:
+    static constexpr size_t CacheLine = 64; ///< Assumed size of a cache line in bytes.
+
+    std::vector<T> slots;                           ///< Ring of values.
+    size_t mask;                                    ///< Slot count minus one, for wrapping indices.
+    alignas(CacheLine) std::atomic<size_t> head{0}; ///< Number of values popped, written by the consumer.
+    alignas(CacheLine) std::atomic<size_t> tail{0}; ///< Number of values pushed, written by the producer.
+
+public:
+    /**
+     * @brief Constructs the queue.
+     *
+     * @param capacity The minimum number of values the queue can hold, rounded up to a power of two.
+     */
+    explicit SpscQueue(size_t capacity) : slots(slotsFor(capacity)), mask(slots.size() - 1) {}
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    /**
+     * @brief Gets the number of slots of a queue constructed with a given capacity.
+     *
+     * @param capacity The minimum number of values.
+     * @return The capacity rounded up to a power of two, at least 2.
+     */
+    static constexpr size_t slotsFor(size_t capacity) { return std::bit_ceil(capacity > 1 ? capacity : size_t{2}); }
+
+    /**
+     * @brief Gets the number of values the queue can hold.
+     */
+    size_t capacity() const { return slots.size(); }
+
+    /**
+     * @brief Gets the number of queued values, exact only on the producer or consumer thread.
+     */
+    size_t size() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Checks whether the queue is empty, exact only on the consumer thread.
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Adds a value, called by the producer only.
+     *
+     * @param value The value to add.
+     * @return False if the queue is full and the value was not added.
+     */
+    template <typename U>
+    bool tryPush(U &&value)
+    {
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (position - head.load(std::memory_order_acquire) >= slots.size())
+        {
+            return false;
+        }
+        slots[position & mask] = std::forward<U>(value);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest value, called by the consumer only.
+     *
+     * @param value Receives the removed value.
+     * @return False if the queue is empty.
+     */
+    bool tryPop(T &value)
+    {
+        size_t position = head.load(std::memory_order_relaxed);
+        if (position == tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = std::move(slots[position & mask]);
+        head.store(position + 1, std::memory_order_release);
+        head.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Blocks the producer until the queue has room for a value.
+     */
+    void waitForSpace()
+    {
+        size_t position = tail.load(std::memory_order_relaxed);
+        size_t popped = head.load(std::memory_order_acquire);
+        while (position - popped >= slots.size())
+        {
+            head.wait(popped, std::memory_order_acquire);
+            popped = head.load(std::memory_order_acquire);
+        }
+    }
+};
@@ -97,10 +97,20 @@ public:
 
     /**
      * @brief Processes all replications by iterating over them.
+     * 
+     * The readers of the next replication start reading ahead (see `Replication::prefetch()`)
+     * before the current replication is processed.
      */
     void processAllReplications() override {
         // Fix: use getReplications().size() instead of getReplicationCount()
-        for (size_t i = 0; i < inputManager.getReplications().size(); i++) {
+        size_t count = inputManager.getReplications().size();
+        if (count > 0) {
+            inputManager.getReplication(0)->prefetch();
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (i + 1 < count) {
+                inputManager.getReplication(static_cast<int>(i + 1))->prefetch();
+            }
             processReplication(i);
         }
     }
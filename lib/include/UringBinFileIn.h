@@ -0,0 +1,267 @@
+#pragma once
+
+#include "FileIn.h"
+#include "IoUring.h"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <span>
+#include <string>
+#include <format>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Class for reading length-prefixed binary data with asynchronous read-ahead.
+ *
+ * This class inherits from `FileIn` and reads the same format as `BinFileIn`
+ * (4-byte little-endian size followed by the data content). The file is read in
+ * chunks through the calling thread's `IoUring`: as soon as the file is opened,
+ * several chunk reads are submitted with one system call, and consumed chunks are
+ * resubmitted for the next part of the file in one batch per refill. Files opened by
+ * the same thread share the ring, so their reads are in flight together; in particular
+ * `Statistics::processAllReplications()` opens the readers of the next replication
+ * (`Replication::prefetch()`) before processing the current one, so its first chunks
+ * are read meanwhile. Without io_uring, or on kernels whose io_uring lacks the read and
+ * write opcodes, the chunks are read with blocking `pread()` calls.
+ *
+ * A returned view stays valid until the next call to `read()`. The file must be
+ * opened, read and closed by the same thread.
+ */
+class UringBinFileIn : public FileIn<std::span<const uint8_t>>
+{
+public:
+    static constexpr size_t DefaultChunkSize = 256 * 1024; ///< Default number of bytes per read request.
+    static constexpr size_t DefaultDepth = 4;              ///< Default number of read requests in flight.
+    static constexpr bool ThreadAffine = true;             ///< The file must be opened, read and closed by one thread.
+
+private:
+    /**
+     * @brief A chunk of the file with its read request.
+     */
+    struct Chunk
+    {
+        std::vector<uint8_t> data; ///< Destination buffer of the read.
+        IoRequest request;         ///< State of the read.
+        uint64_t offset = 0;       ///< File offset of the chunk.
+        size_t length = 0;         ///< Number of bytes requested, 0 past the end of the file.
+    };
+
+    std::vector<Chunk> chunks;   ///< Read-ahead chunks, consumed in a round-robin fashion.
+    std::vector<uint8_t> buffer; ///< Buffer holding the unparsed bytes of consumed chunks.
+    IoUring *ring = nullptr;     ///< Ring the reads are submitted to.
+    int fd = -1;                 ///< Descriptor of the open file.
+    uint64_t fileSize = 0;       ///< Size of the file when it was opened.
+    uint64_t nextOffset = 0;     ///< File offset of the next chunk to request.
+    size_t nextChunk = 0;        ///< Index of the next chunk to consume.
+    size_t begin = 0;            ///< Offset of the first unparsed byte in the buffer.
+    size_t end = 0;              ///< Offset one past the last valid byte in the buffer.
+    size_t chunkSize;            ///< Number of bytes per read request.
+    size_t depth;                ///< Number of read requests in flight.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of bytes per read request.
+     * @param inFlight The number of read requests kept in flight.
+     */
+    explicit UringBinFileIn(size_t size = DefaultChunkSize, size_t inFlight = DefaultDepth)
+        : chunkSize(size > 0 ? size : DefaultChunkSize), depth(inFlight > 0 ? inFlight : DefaultDepth) {}
+
+    /**
+     * @brief Destructor that waits for outstanding reads and closes the file.
+     */
+    ~UringBinFileIn() { close(); }
+
+    /**
+     * @brief Opens a binary file and starts reading ahead.
+     *
+     * @param file The path to the binary file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(std::string_view file) override
+    {
+        close();
+
+        std::string fileName(file);
+        fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            close();
+            throw std::runtime_error(std::format("Failed to stat file: {}", file));
+        }
+
+        ring = &IoUring::local();
+        fileSize = static_cast<uint64_t>(info.st_size);
+        nextOffset = 0;
+        nextChunk = 0;
+
+        chunks.resize(depth);
+        for (auto &chunk : chunks)
+        {
+            chunk.data.resize(chunkSize);
+            submit(chunk);
+        }
+        ring->submit();
+    }
+
+    /**
+     * @brief Waits for outstanding reads and closes the file.
+     */
+    void close() noexcept override
+    {
+        for (auto &chunk : chunks)
+        {
+            if (!chunk.request.done)
+            {
+                try
+                {
+                    ring->wait(chunk.request);
+                }
+                catch (const std::exception &)
+                {
+                    // The ring is unusable, nothing is left to wait for
+                }
+            }
+            chunk.length = 0;
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+            fd = -1;
+        }
+        begin = 0;
+        end = 0;
+    }
+
+    /**
+     * @brief Reads the next record from the file.
+     *
+     * Reads the size of the data (4 bytes, little-endian) and returns a view of the
+     * following data content. An empty view is returned at the end of the file.
+     *
+     * @return A view of the record bytes inside the buffer.
+     * @throws std::runtime_error If the file is not open, reading fails or the record is truncated.
+     */
+    std::span<const uint8_t> read() override
+    {
+        if (fd < 0)
+        {
+            throw std::runtime_error("No file opened for reading");
+        }
+
+        if (!fill(sizeof(uint32_t)))
+        {
+            return {};
+        }
+
+        // Read size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = 0;
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            dataSize |= static_cast<uint32_t>(buffer[begin + i]) << (i * 8);
+        }
+
+        if (!fill(sizeof(dataSize) + dataSize))
+        {
+            throw std::runtime_error("Failed to read data content");
+        }
+
+        std::span<const uint8_t> record(buffer.data() + begin + sizeof(dataSize), dataSize);
+        begin += sizeof(dataSize) + dataSize;
+        return record;
+    }
+
+private:
+    /**
+     * @brief Queues a request for the next part of the file into the given chunk.
+     */
+    void submit(Chunk &chunk)
+    {
+        chunk.offset = nextOffset;
+        chunk.length = static_cast<size_t>(std::min<uint64_t>(chunkSize, fileSize - nextOffset));
+        if (chunk.length > 0)
+        {
+            ring->read(fd, chunk.data.data(), static_cast<unsigned>(chunk.length), chunk.offset, chunk.request);
+            nextOffset += chunk.length;
+        }
+    }
+
+    /**
+     * @brief Ensures that at least `count` unparsed bytes are in the buffer.
+     *
+     * Appends the next chunks in file order, waiting for their reads where necessary,
+     * and resubmits every consumed chunk for the next part of the file.
+     *
+     * @param count The number of bytes required.
+     * @return True if the bytes are available, false if the file ended first.
+     * @throws std::runtime_error If a read fails.
+     */
+    bool fill(size_t count)
+    {
+        if (end - begin >= count)
+        {
+            return true;
+        }
+
+        // Keep the partial record, it continues in the next chunk
+        size_t remaining = end - begin;
+        if (begin > 0 && remaining > 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + begin, remaining);
+        }
+        begin = 0;
+        end = remaining;
+
+        while (end < count)
+        {
+            Chunk &chunk = chunks[nextChunk];
+            if (chunk.length == 0)
+            {
+                ring->submit();
+                return false;
+            }
+
+            ring->wait(chunk.request);
+            if (chunk.request.result < 0)
+            {
+                throw std::runtime_error(std::format("Failed to read data block: {}", std::strerror(-chunk.request.result)));
+            }
+
+            // Complete a short read synchronously
+            size_t done = static_cast<size_t>(chunk.request.result);
+            while (done < chunk.length)
+            {
+                ssize_t result = ::pread(fd, chunk.data.data() + done, chunk.length - done, static_cast<off_t>(chunk.offset + done));
+                if (result <= 0)
+                {
+                    throw std::runtime_error("Failed to read data block");
+                }
+                done += static_cast<size_t>(result);
+            }
+
+            if (buffer.size() < end + chunk.length)
+            {
+                buffer.resize(end + chunk.length);
+            }
+            std::memcpy(buffer.data() + end, chunk.data.data(), chunk.length);
+            end += chunk.length;
+
+            submit(chunk);
+            nextChunk = (nextChunk + 1) % chunks.size();
+        }
+
+        // Hand the resubmitted chunks to the kernel together
+        ring->submit();
+        return true;
+    }
+};
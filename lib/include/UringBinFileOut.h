@@ -0,0 +1,237 @@
+#pragma once
+
+#include "FileOut.h"
+#include "IoUring.h"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <format>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief Class for writing length-prefixed binary data with asynchronous writes.
+ *
+ * This class inherits from `FileOut` and writes the same format as `BinFileOut`
+ * (4-byte little-endian size followed by the data content). Records are collected
+ * in chunk buffers; a full chunk is handed to the calling thread's `IoUring` and
+ * writing continues into the next chunk while it is in flight. Without io_uring the
+ * chunks are written with blocking `pwrite()` calls.
+ *
+ * The file must be opened, written and closed by the same thread.
+ */
+class UringBinFileOut : public FileOut<std::vector<uint8_t>>
+{
+public:
+    static constexpr size_t DefaultChunkSize = 256 * 1024; ///< Default number of bytes per write request.
+    static constexpr size_t DefaultDepth = 4;              ///< Default number of write requests in flight.
+    static constexpr bool ThreadAffine = true;             ///< The file must be opened, written and closed by one thread.
+
+private:
+    /**
+     * @brief A chunk of the file with its write request.
+     */
+    struct Chunk
+    {
+        std::vector<uint8_t> data; ///< Source buffer of the write.
+        IoRequest request;         ///< State of the write.
+        uint64_t offset = 0;       ///< File offset of the chunk.
+    };
+
+    std::vector<Chunk> chunks; ///< Chunk buffers, filled in a round-robin fashion.
+    IoUring *ring = nullptr;   ///< Ring the writes are submitted to.
+    int fd = -1;               ///< Descriptor of the open file.
+    uint64_t nextOffset = 0;   ///< File offset of the chunk being filled.
+    size_t current = 0;        ///< Index of the chunk being filled.
+    size_t chunkSize;          ///< Number of bytes per write request.
+    size_t depth;              ///< Number of write requests in flight.
+
+public:
+    /**
+     * @brief Constructs the file handler.
+     *
+     * @param size The number of bytes per write request.
+     * @param inFlight The number of write requests kept in flight.
+     */
+    explicit UringBinFileOut(size_t size = DefaultChunkSize, size_t inFlight = DefaultDepth)
+        : chunkSize(size > 0 ? size : DefaultChunkSize), depth(inFlight > 0 ? inFlight : DefaultDepth) {}
+
+    /**
+     * @brief Destructor that writes out buffered records and closes the file.
+     */
+    ~UringBinFileOut() { close(); }
+
+    /**
+     * @brief Opens (and truncates) a binary file for writing.
+     *
+     * @param file The path to the binary file to open.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    void open(const std::string_view file) override
+    {
+        close();
+
+        std::string fileName(file);
+        fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            throw std::runtime_error(std::format("Failed to open file: {}", file));
+        }
+
+        ring = &IoUring::local();
+        nextOffset = 0;
+        current = 0;
+        chunks.resize(depth);
+        for (auto &chunk : chunks)
+        {
+            chunk.data.clear();
+            chunk.data.reserve(chunkSize);
+        }
+    }
+
+    /**
+     * @brief Writes out buffered records, waits for outstanding writes and closes the file.
+     */
+    void close() noexcept override
+    {
+        if (fd < 0)
+        {
+            return;
+        }
+
+        try
+        {
+            flush();
+        }
+        catch (const std::exception &)
+        {
+            // close() cannot report errors, wait for the remaining writes before releasing the buffers
+            bool inFlight = false;
+            for (auto &chunk : chunks)
+            {
+                try
+                {
+                    ring->wait(chunk.request);
+                }
+                catch (const std::exception &)
+                {
+                    inFlight = inFlight || !chunk.request.done;
+                }
+            }
+            if (inFlight)
+            {
+                // The kernel may still write from the buffers, so they are abandoned instead of
+                // freed or reused; moving the vector keeps the chunks at their addresses
+                new std::vector<Chunk>(std::move(chunks));
+                chunks.clear();
+            }
+        }
+
+        ::close(fd);
+        fd = -1;
+    }
+
+    /**
+     * @brief Writes binary data to the file.
+     *
+     * Writes the size of the data (4 bytes, little-endian) followed by the actual data content.
+     *
+     * @param data The vector of bytes to write to the file.
+     * @throws std::runtime_error If the file is not open for writing or a previous write failed.
+     */
+    void write(const std::vector<uint8_t> &data) override
+    {
+        if (fd < 0)
+        {
+            throw std::runtime_error("Failed to open file for writing");
+        }
+
+        Chunk &chunk = chunks[current];
+
+        // Write size in a portable way (little-endian, fixed 4 bytes)
+        uint32_t dataSize = static_cast<uint32_t>(data.size());
+        for (size_t i = 0; i < sizeof(dataSize); ++i)
+        {
+            chunk.data.push_back(static_cast<uint8_t>(dataSize >> (i * 8)));
+        }
+        chunk.data.insert(chunk.data.end(), data.begin(), data.end());
+
+        if (chunk.data.size() >= chunkSize)
+        {
+            submit(chunk);
+            current = (current + 1) % chunks.size();
+            complete(chunks[current]);
+        }
+    }
+
+    /**
+     * @brief Writes out buffered records and waits until all writes are done.
+     *
+     * @throws std::runtime_error If a write failed.
+     */
+    void flush() override
+    {
+        if (fd < 0)
+        {
+            return;
+        }
+
+        if (!chunks[current].data.empty())
+        {
+            submit(chunks[current]);
+            current = (current + 1) % chunks.size();
+        }
+        for (auto &chunk : chunks)
+        {
+            complete(chunk);
+        }
+    }
+
+private:
+    /**
+     * @brief Hands a filled chunk to the ring.
+     */
+    void submit(Chunk &chunk)
+    {
+        chunk.offset = nextOffset;
+        nextOffset += chunk.data.size();
+        ring->write(fd, chunk.data.data(), static_cast<unsigned>(chunk.data.size()), chunk.offset, chunk.request);
+        ring->submit();
+    }
+
+    /**
+     * @brief Waits for the chunk's write and empties the chunk for reuse.
+     *
+     * A short write is completed synchronously.
+     *
+     * @throws std::runtime_error If the write failed.
+     */
+    void complete(Chunk &chunk)
+    {
+        if (chunk.data.empty())
+        {
+            return;
+        }
+
+        ring->wait(chunk.request);
+        if (chunk.request.result < 0)
+        {
+            chunk.data.clear();
+            throw std::runtime_error(std::format("Failed to write data block: {}", std::strerror(-chunk.request.result)));
+        }
+
+        size_t done = static_cast<size_t>(chunk.request.result);
+        while (done < chunk.data.size())
+        {
+            ssize_t result = ::pwrite(fd, chunk.data.data() + done, chunk.data.size() - done, static_cast<off_t>(chunk.offset + done));
+            if (result <= 0)
+            {
+                chunk.data.clear();
+                throw std::runtime_error("Failed to write data block");
+            }
+            done += static_cast<size_t>(result);
+        }
+        chunk.data.clear();
+    }
+};
@@ -1,10 +1,17 @@
 #pragma once
 
+#include "Converter.h"
 #include <string>
 #include <ostream>
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include <format>
+#include <cstdint>
+#include <span>
+#include <ranges>
+#include <type_traits>
+#include <utility>
 
 /**
  * @brief Abstract base class for all writer implementations.
@@ -22,6 +29,31 @@ public:
      * @brief Closes the writer, ensuring all resources are released.
      */
     virtual void close() = 0;
+
+    /**
+     * @brief Writes out any buffered data without closing the writer.
+     */
+    virtual void flush() = 0;
+
+    /**
+     * @brief Gets the path the writer writes to.
+     */
+    virtual const std::string &getPath() const = 0;
+
+    /**
+     * @brief Closes the writer and retargets it at another file.
+     * 
+     * The writer keeps its buffers, the new file is opened by the next write.
+     * The record count starts again from zero.
+     * 
+     * @param pFile The path of the new file.
+     */
+    virtual void setPath(const std::string &pFile) = 0;
+
+    /**
+     * @brief Gets the number of records written by the writer.
+     */
+    virtual uint64_t getRecordCount() const = 0;
 };
 
 /**
@@ -30,6 +62,10 @@ public:
  * This template class provides a flexible mechanism for writing data of type `T`
  * to a file using a converter `C` and a file handler `F`.
  * 
+ * Every record is encoded with the converter's `encode()` into one buffer owned by the
+ * writer, so with converters that fill it in place (e.g. `CasinoBinConverter`) writing a
+ * record allocates no memory once the buffer has grown.
+ * 
  * @tparam T The type of data to be written.
  * @tparam C The converter class responsible for transforming `T` into a writable format.
  * @tparam F The file handling class that manages the actual file operations.
@@ -37,15 +73,22 @@ public:
 template <typename T, typename C, typename F>
 class Writer : public IWriter
 {
-private:
-    C converter;         ///< Converter instance for transforming data before writing.
-    F file;              ///< File handler instance for managing file operations.
-    std::string path;    ///< File path.
-    bool isOpen = false; ///< Flag indicating whether the file is currently open.
-
 public:
     using DataType = T; ///< Defines the data type handled by the writer.
+    using EncodedType = std::remove_cvref_t<decltype(std::declval<C &>().convert(std::declval<const T &>()))>; ///< Type of an encoded record.
 
+    static constexpr size_t BatchSize = 1024; ///< Number of records handed to the file handler at once by `write(range)`.
+
+private:
+    C converter;                    ///< Converter instance for transforming data before writing.
+    F file;                         ///< File handler instance for managing file operations.
+    EncodedType encoded{};          ///< Reusable buffer for encoded records.
+    std::vector<EncodedType> batch; ///< Reusable encoded records of `write(range)`.
+    std::string path;               ///< File path.
+    uint64_t recordCount = 0;       ///< Number of records written.
+    bool isOpen = false;            ///< Flag indicating whether the file is currently open.
+
+public:
     Writer() = default;
 
     /**
@@ -107,6 +150,53 @@ public:
         }
     }
 
+    /**
+     * @brief Flushes the file.
+     * 
+     * Writes out all data buffered by the file handler. Does nothing if the file is not open.
+     */
+    void flush() override
+    {
+        if (isOpen)
+        {
+            file.flush();
+        }
+    }
+
+    /**
+     * @brief Gets the file handler.
+     * 
+     * Allows configuring the file handler (e.g. its buffer size) before writing.
+     * 
+     * @return A reference to the file handler instance.
+     */
+    F &getFile() { return file; }
+
+    /**
+     * @brief Gets the file path given on construction or by `setPath()`.
+     */
+    const std::string &getPath() const override { return path; }
+
+    /**
+     * @brief Closes the file and retargets the writer, keeping its buffers.
+     * 
+     * @param pFile The path of the new file, opened by the next write.
+     */
+    void setPath(const std::string &pFile) override
+    {
+        if (isOpen)
+        {
+            close();
+        }
+        path = pFile;
+        recordCount = 0;
+    }
+
+    /**
+     * @brief Gets the number of records written.
+     */
+    uint64_t getRecordCount() const override { return recordCount; }
+
     /**
      * @brief Writes a single data entry to the file.
      * 
@@ -127,13 +217,15 @@ public:
             open(path);
         }
 
-        file.write(converter.convert(data));
+        writeRecord(data);
     }
 
     /**
      * @brief Writes a range of data entries to the file.
      * 
-     * Each entry in the range is converted and written to the file.
+     * The entries are encoded into a reusable batch of up to `BatchSize` records, and each
+     * batch is handed to the file handler with a single `writeBatch()` call, which the
+     * buffered handlers append to their staging buffer in one pass.
      * If the file is not already open, it will be opened.
      * 
      * @tparam Range The type of the range containing data entries.
@@ -152,8 +244,57 @@ public:
             open(path);
         }
 
-        std::ranges::for_each(dataRange, [this](const T &item) {
-            file.write(converter.convert(item));
-        });
+        if constexpr (requires(F &f, std::span<const EncodedType> records) { f.writeBatch(records); })
+        {
+            size_t count = 0;
+            for (const T &item : dataRange)
+            {
+                if (count == batch.size())
+                {
+                    batch.emplace_back();
+                }
+                converter.encode(item, batch[count]);
+
+                if (++count == BatchSize)
+                {
+                    writeBatch(count);
+                    count = 0;
+                }
+            }
+            if (count > 0)
+            {
+                writeBatch(count);
+            }
+        }
+        else
+        {
+            std::ranges::for_each(dataRange, [this](const T &item) {
+                writeRecord(item);
+            });
+        }
+    }
+
+private:
+    /**
+     * @brief Converts a record and passes it to the file handler.
+     * 
+     * @param data The data entry to write.
+     */
+    void writeRecord(const T &data)
+    {
+        converter.encode(data, encoded);
+        file.write(encoded);
+        ++recordCount;
+    }
+
+    /**
+     * @brief Passes the first records of the batch to the file handler.
+     * 
+     * @param count The number of encoded records in `batch`.
+     */
+    void writeBatch(size_t count)
+    {
+        file.writeBatch(std::span<const EncodedType>(batch.data(), count));
+        recordCount += count;
     }
 };
\ No newline at end of file